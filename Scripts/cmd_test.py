@@ -392,6 +392,44 @@ class TCPShell(cmd.Cmd):
         except Exception as e:
             print(f"Error: {e} - ({type(e).__name__})")
 
+    def do_display_set_brightness(self, arg):
+        'display_set_brightness <1-255>'
+        arg_list = arg.split()
+        if (len(arg_list) != 1):
+            print("Error: Invalid input, needs 1 argument")
+            return
+        brightness = int(arg_list[0], 0)
+
+        try:
+            socket_test.display_set_brightness(self.tcp_socket, brightness)
+        except Exception as e:
+            print(f"Error: {e} - ({type(e).__name__})")
+
+    def do_display_set_idle_refresh(self, arg):
+        'display_set_idle_refresh <hz>'
+        arg_list = arg.split()
+        if (len(arg_list) != 1):
+            print("Error: Invalid input, needs 1 argument")
+            return
+        refresh_hz = int(arg_list[0], 0)
+
+        try:
+            socket_test.display_set_idle_refresh(self.tcp_socket, refresh_hz)
+        except Exception as e:
+            print(f"Error: {e} - ({type(e).__name__})")
+
+    def do_display_get_info(self, arg):
+        'display_get_info'
+        try:
+            (brightness, refresh_hz, idle_refresh_hz, frames, writes, wakeups,
+             presented, dropped, repeated, latency_us, latency_us_max, queue_depth) = socket_test.display_get_info(self.tcp_socket)
+            print(f"Brightness: {brightness}, Refresh: {refresh_hz}Hz, Idle Refresh: {idle_refresh_hz}Hz")
+            print(f"Frames: {frames}, Writes: {writes}, Wakeups: {wakeups}")
+            print(f"Queue Depth: {queue_depth}, Presented: {presented}, Dropped: {dropped}, Repeated: {repeated}")
+            print(f"Latency: {latency_us}us, Max: {latency_us_max}us")
+        except Exception as e:
+            print(f"Error: {e} - ({type(e).__name__})")
+
     def do_exit(self, arg):
         'Stop recording, close the turtle window, and exit:  BYE'
         print('Exiting TCPShell...')
@@ -0,0 +1,126 @@
+"""
+Generates main/FFT/FFT_tables.c/.h, the const twiddle tables used by the
+static FFT plans (FFT_RADIX4_STATIC_PLAN / FFT_Q15_STATIC_PLAN). Consts end
+up in flash (DROM) so static plans don't use any heap or DRAM for twiddles.
+
+The layouts must match radix4_init_twiddles() in FFT.c and fft_q15_init()
+in FFT_fixed.c, fft_bench checks that they do.
+
+Usage: python gen_fft_tables.py [--sizes 1024 2048 ...]
+"""
+import argparse
+import math
+import os
+import struct
+from pathlib import Path
+
+scripts_dir = Path(os.path.dirname(os.path.realpath(__file__)))
+fft_dir = scripts_dir / ".." / "main" / "FFT"
+
+DEFAULT_SIZES = [1024, 2048]
+VALUES_PER_LINE = 8
+
+
+def to_float32(v):
+    return struct.unpack('f', struct.pack('f', v))[0]
+
+
+def q15(v):
+    # Python's round() is round half to even, same as lrint()
+    return int(round(32767.0 * v))
+
+
+def radix4_real_twiddles(n):
+    # Real/complex split twiddles, then the stages of the n / 2 point complex FFT
+    table = []
+    for k in range(n // 4):
+        a = 2.0 * math.pi * k / n
+        table += [math.cos(a), math.sin(a)]
+
+    m = n // 2
+    span = 2 if int(math.log2(m)) & 1 else 1
+    while 4 * span <= m:
+        if span > 1:
+            step = 2.0 * math.pi / (4 * span)
+            for k in range(span):
+                a = step * k
+                table += [math.cos(a), math.sin(a),
+                          math.cos(2 * a), math.sin(2 * a),
+                          math.cos(3 * a), math.sin(3 * a)]
+        span *= 4
+    return [to_float32(v) for v in table]
+
+
+def q15_twiddles(n):
+    table = []
+    for k in range(n // 4):
+        a = 2.0 * math.pi * k / n
+        table += [q15(math.cos(a)), q15(math.sin(a))]
+
+    half = 2
+    while half < n // 2:
+        for k in range(half):
+            a = math.pi * k / half
+            table += [q15(math.cos(a)), q15(math.sin(a))]
+        half *= 2
+    return table
+
+
+def c_float(v):
+    s = f"{v:.9g}"
+    if not any(c in s for c in ".en"):
+        s += ".0"
+    return s + "f"
+
+
+def format_table(decl, values, fmt):
+    lines = [decl + " = {"]
+    for i in range(0, len(values), VALUES_PER_LINE):
+        lines.append("    " + ", ".join(fmt(v) for v in values[i:i + VALUES_PER_LINE]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate static FFT twiddle tables")
+    parser.add_argument("--sizes", type=int, nargs="+", default=DEFAULT_SIZES, help="Real FFT sizes (powers of two, 16 to 4096)")
+    args = parser.parse_args()
+
+    sizes = sorted(set(args.sizes))
+    for n in sizes:
+        if n < 16 or n > 4096 or (n & (n - 1)) != 0:
+            parser.error(f"Unsupported FFT size {n}")
+
+    header = [
+        "// Generated by Scripts/gen_fft_tables.py, do not edit",
+        "#pragma once",
+        "#include <stdint.h>",
+        "",
+    ]
+    source = [
+        "// Generated by Scripts/gen_fft_tables.py, do not edit",
+        '#include "FFT_tables.h"',
+        "",
+    ]
+    for n in sizes:
+        r4 = radix4_real_twiddles(n)
+        q = q15_twiddles(n)
+        header += [
+            f"#define FFT_TABLES_HAVE_{n} 1",
+            f"extern const float fft_radix4_real_twiddles_{n}[{len(r4)}];",
+            f"extern const int16_t fft_q15_twiddles_{n}[{len(q)}];",
+            "",
+        ]
+        source += [
+            format_table(f"const float fft_radix4_real_twiddles_{n}[{len(r4)}]", r4, c_float),
+            "",
+            format_table(f"const int16_t fft_q15_twiddles_{n}[{len(q)}]", q, str),
+            "",
+        ]
+
+    (fft_dir / "FFT_tables.h").write_text("\n".join(header))
+    (fft_dir / "FFT_tables.c").write_text("\n".join(source))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,150 @@
+"""
+Generates main/Font_tables.c/.h, the glyph atlas used by Font.c. Every glyph
+is stored as column masks (bit y is row y) plus its advance width, indexed
+straight by character code so drawing text doesn't need any per character
+lookups. Lowercase letters share the uppercase glyphs.
+
+Glyphs are drawn below, one string per row with '#' for a lit pixel. The row
+length is the advance width, blank columns are the spacing between glyphs.
+
+Usage: python gen_font_tables.py
+"""
+import os
+from pathlib import Path
+
+scripts_dir = Path(os.path.dirname(os.path.realpath(__file__)))
+main_dir = scripts_dir / ".." / "main"
+
+FONT_HEIGHT = 5
+FIRST_CHAR = ord('!')
+LAST_CHAR = ord('z')
+
+GLYPHS = [
+    ('!', ['.#', '.#', '.#', '..', '.#']),
+    ('"', ['.#.#', '.#.#', '....', '....', '....']),
+    ('#', ['..#.#.', '.#####', '..#.#.', '.#####', '..#.#.']),
+    ('$', ['.....', '.....', '.....', '.....', '.....']),
+    ('%', ['.....', '.#..#', '...#.', '..#..', '.#..#']),
+    ('&', ['.....', '.....', '.....', '.....', '.....']),
+    ("'", ['.#', '.#', '..', '..', '..']),
+    ('(', ['..#', '.#.', '.#.', '.#.', '..#']),
+    (')', ['.#.', '..#', '..#', '..#', '.#.']),
+    ('*', ['....', '.#.#', '..#.', '.#.#', '....']),
+    ('+', ['....', '..#.', '.###', '..#.', '....']),
+    (',', ['...', '...', '...', '..#', '.#.']),
+    ('-', ['....', '....', '.###', '....', '....']),
+    ('.', ['..', '..', '..', '..', '.#']),
+    ('/', ['.....', '....#', '...#.', '..#..', '.#...']),
+    ('0', ['.####', '.#..#', '.#..#', '.#..#', '.####']),
+    ('1', ['...#.', '..##.', '...#.', '...#.', '..###']),
+    ('2', ['.####', '....#', '.####', '.#...', '.####']),
+    ('3', ['.####', '....#', '.####', '....#', '.####']),
+    ('4', ['.#..#', '.#..#', '.####', '....#', '....#']),
+    ('5', ['.####', '.#...', '.####', '....#', '.####']),
+    ('6', ['.####', '.#...', '.####', '.#..#', '.####']),
+    ('7', ['.####', '....#', '....#', '....#', '....#']),
+    ('8', ['.####', '.#..#', '.####', '.#..#', '.####']),
+    ('9', ['.####', '.#..#', '.####', '....#', '.####']),
+    (':', ['..', '.#', '..', '.#', '..']),
+    (';', ['..', '.#', '..', '.#', '.#']),
+    ('<', ['...#', '..#.', '.#..', '..#.', '...#']),
+    ('=', ['....', '.###', '....', '.###', '....']),
+    ('>', ['.#..', '..#.', '...#', '..#.', '.#..']),
+    ('A', ['..##.', '.#..#', '.####', '.#..#', '.#..#']),
+    ('B', ['.###.', '.#..#', '.###.', '.#..#', '.###.']),
+    ('C', ['..##.', '.#..#', '.#...', '.#..#', '..##.']),
+    ('D', ['.###.', '.#..#', '.#..#', '.#..#', '.###.']),
+    ('E', ['.####', '.#...', '.####', '.#...', '.####']),
+    ('F', ['.####', '.#...', '.####', '.#...', '.#...']),
+    ('G', ['..##.', '.#...', '.#.##', '.#..#', '..##.']),
+    ('H', ['.#..#', '.#..#', '.####', '.#..#', '.#..#']),
+    ('I', ['.#####', '...#..', '...#..', '...#..', '.#####']),
+    ('J', ['....#', '....#', '....#', '.#..#', '..##.']),
+    ('K', ['.#..#', '.#.#.', '.##..', '.#.#.', '.#..#']),
+    ('L', ['.#...', '.#...', '.#...', '.#...', '.####']),
+    ('M', ['.#...#', '.##.##', '.#.#.#', '.#...#', '.#...#']),
+    ('N', ['.#...#', '.##..#', '.#.#.#', '.#..##', '.#...#']),
+    ('O', ['..##.', '.#..#', '.#..#', '.#..#', '..##.']),
+    ('P', ['.###.', '.#..#', '.###.', '.#...', '.#...']),
+    ('Q', ['..###.', '.#...#', '.#...#', '.#..#.', '..##.#']),
+    ('R', ['.###.', '.#..#', '.###.', '.#..#', '.#..#']),
+    ('S', ['..###', '.#...', '..##.', '....#', '.###.']),
+    ('T', ['.#####', '...#..', '...#..', '...#..', '...#..']),
+    ('U', ['.#..#', '.#..#', '.#..#', '.#..#', '..##.']),
+    ('V', ['.#...#', '.#...#', '.#...#', '..#.#.', '...#..']),
+    ('W', ['.#...#', '.#...#', '.#.#.#', '.##.##', '.#...#']),
+    ('X', ['.#..#', '.#..#', '..##.', '.#..#', '.#..#']),
+    ('Y', ['.#..#', '.#..#', '.####', '....#', '.####']),
+    ('Z', ['.####', '....#', '..##.', '.#...', '.####']),
+    ('[', ['.##', '.#.', '.#.', '.#.', '.##']),
+    ('\\', ['.....', '.#...', '..#..', '...#.', '....#']),
+    (']', ['.##', '..#', '..#', '..#', '.##']),
+    ('^', ['..#.', '.#.#', '....', '....', '....']),
+    ('_', ['....', '....', '....', '....', '.###']),
+]
+
+
+def glyph_columns(rows):
+    width = len(rows[0])
+    if len(rows) != FONT_HEIGHT or any(len(r) != width for r in rows):
+        raise ValueError(f"Bad glyph rows {rows}")
+    return [sum(1 << y for y, r in enumerate(rows) if r[x] == '#') for x in range(width)]
+
+
+def c_char(code):
+    c = chr(code)
+    return "'\\''" if c == "'" else "'\\\\'" if c == "\\" else f"'{c}'"
+
+
+def main():
+    glyphs = {ord(c): glyph_columns(rows) for c, rows in GLYPHS}
+    for c in range(ord('a'), ord('z') + 1):
+        glyphs[c] = glyphs[c - ord('a') + ord('A')]
+    max_width = max(len(cols) for cols in glyphs.values())
+
+    count = LAST_CHAR - FIRST_CHAR + 1
+    widths = []
+    columns = []
+    for code in range(FIRST_CHAR, LAST_CHAR + 1):
+        cols = glyphs.get(code, [])
+        widths.append(f"    {len(cols)}, // {c_char(code)}")
+        masks = ", ".join(f"0x{m:02X}" for m in cols + [0] * (max_width - len(cols)))
+        columns.append(f"    {{{masks}}}, // {c_char(code)}")
+
+    header = [
+        "// Generated by Scripts/gen_font_tables.py, do not edit",
+        "#pragma once",
+        "#include <stdint.h>",
+        "",
+        f"#define FONT_HEIGHT {FONT_HEIGHT}",
+        f"#define FONT_MAX_WIDTH {max_width}",
+        f"#define FONT_FIRST_CHAR {FIRST_CHAR} // {c_char(FIRST_CHAR)}",
+        f"#define FONT_LAST_CHAR {LAST_CHAR} // {c_char(LAST_CHAR)}",
+        f"#define FONT_GLYPH_COUNT {count}",
+        "",
+        "// Advance width in columns, 0 for characters without a glyph",
+        "extern const uint8_t font_glyph_widths[FONT_GLYPH_COUNT];",
+        "// Bit y of a column is row y of the glyph",
+        "extern const uint8_t font_glyph_columns[FONT_GLYPH_COUNT][FONT_MAX_WIDTH];",
+        "",
+    ]
+    source = [
+        "// Generated by Scripts/gen_font_tables.py, do not edit",
+        '#include "Font_tables.h"',
+        "",
+        "const uint8_t font_glyph_widths[FONT_GLYPH_COUNT] = {",
+        *widths,
+        "};",
+        "",
+        "const uint8_t font_glyph_columns[FONT_GLYPH_COUNT][FONT_MAX_WIDTH] = {",
+        *columns,
+        "};",
+        "",
+    ]
+
+    (main_dir / "Font_tables.h").write_text("\n".join(header))
+    (main_dir / "Font_tables.c").write_text("\n".join(source))
+
+
+if __name__ == "__main__":
+    main()
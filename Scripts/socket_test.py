@@ -61,6 +61,9 @@ class MessageID(IntEnum):
     BATT_GET_VOLTAGE = 23
     RTC_GET_TIME = 24
     RTC_SET_TIME = 25
+    DISPLAY_SET_BRIGHTNESS = 26
+    DISPLAY_SET_IDLE_REFRESH = 27
+    DISPLAY_GET_INFO = 28
 
 class PinMode(IntEnum):
     GPIO_MODE_DISABLE = 0
@@ -456,6 +459,44 @@ def rtc_set_time(sock, hour, min, sec):
     if (resp.message_id != MessageID.ACK):
         raise Exception("Device did not ACK back")
 
+def display_set_brightness(sock, brightness):
+    if (isinstance(brightness, int) == False):
+        raise Exception(f"brightness ({brightness}), must be an integer")
+    if (brightness < 1 or brightness > 255):
+        raise Exception(f"brightness ({brightness}), must be between 1 and 255")
+
+    message_payload = struct.pack("<B", brightness)
+    resp = send_message(sock, MessageID.DISPLAY_SET_BRIGHTNESS, message_payload, True)
+
+    if (resp):
+        print(resp)
+    if (resp.message_id != MessageID.ACK):
+        raise Exception("Device did not ACK back")
+
+def display_set_idle_refresh(sock, refresh_hz):
+    if (isinstance(refresh_hz, int) == False):
+        raise Exception(f"refresh_hz ({refresh_hz}), must be an integer")
+    if (refresh_hz < 0 or refresh_hz > 255):
+        raise Exception(f"refresh_hz ({refresh_hz}), must fit in a byte")
+
+    message_payload = struct.pack("<B", refresh_hz)
+    resp = send_message(sock, MessageID.DISPLAY_SET_IDLE_REFRESH, message_payload, True)
+
+    if (resp):
+        print(resp)
+    if (resp.message_id != MessageID.ACK):
+        raise Exception("Device did not ACK back")
+
+def display_get_info(sock):
+    resp = send_message(sock, MessageID.DISPLAY_GET_INFO, None, True)
+
+    if (resp):
+        print(resp)
+    if (resp.message_id != MessageID.DISPLAY_GET_INFO):
+        raise Exception("Invalid response")
+
+    return struct.unpack("<BBBIIIIIIIIB", resp.payload)
+
 if __name__ == '__main__':
     HOST = "192.168.0.226"
     PORT = 3333
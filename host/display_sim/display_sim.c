@@ -0,0 +1,607 @@
+/*
+ * Host display simulator for the frame buffer drawers
+ *
+ * Runs scenes drawn with the firmware's own FrameBuffer.c, Font.c, Bitmap.c,
+ * Animation.c and FFT_draw.c into display_buffer. A stub display task
+ * latches the published frame once per refresh the way Display_task.c
+ * does. Each latched frame_buffer_t is decoded pixel by pixel with the bit
+ * order of the board it was built for, so the same scene built for
+ * CONFIG_DEV_BOARD_DISPLAY and CONFIG_FORM_FACTOR_DISPLAY has to give the
+ * same picture, apart from the width.
+ *
+ * Frames are written as text, one character per pixel: '.' is off, '#' is
+ * fully on and 1 to e are partial levels. --check compares every scene
+ * with its golden file in DIR/<board>/<scene>.txt, and --update rewrites
+ * the golden files. --term prints the frames, and --ppm writes one PPM
+ * image per frame to DIR.
+ *
+ * The frame queue is checked at depths 2 to FRAME_QUEUE_MAX_DEPTH with a
+ * producer that publishes several frames between refreshes: the frames the
+ * display picks up and the presented, dropped and repeated counts have to
+ * match what the depth allows.
+ *
+ * The time to draw and publish each frame is the minimum over the timing
+ * passes. The report gives the mean and worst frame of each scene, and
+ * --csv records every frame.
+ *
+ * Usage: display_sim [--check DIR | --update DIR] [--term] [--ppm DIR] [--csv FILE] [passes]
+ */
+#include "FrameBuffer.h"
+#include "Font.h"
+#include "Bitmap.h"
+#include "Animation.h"
+#include "FFT_bars.h"
+#include "FFT_draw.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(CONFIG_DEV_BOARD_DISPLAY)
+#define SIM_BOARD "dev_board"
+#elif defined(CONFIG_FORM_FACTOR_DISPLAY)
+#define SIM_BOARD "form_factor"
+#endif
+
+#define SIM_DEFAULT_PASSES 200
+#define SIM_REFRESH_RATE_HZ 90
+#define SIM_MAX_FRAMES 64
+// One character per pixel plus a newline for every row, and a header line
+#define SIM_FRAME_TEXT ((FRAME_BUF_COLS + 1) * FRAME_BUF_ROWS + 32)
+#define SIM_SCENE_TEXT (SIM_MAX_FRAMES * SIM_FRAME_TEXT)
+#define SIM_PPM_SCALE 8
+
+typedef struct
+{
+    const char *name;
+    int frames;
+    void (*setup)(void);
+    void (*draw)(int frame);
+} sim_scene_t;
+
+// Function Prototypes
+static void setup_none(void);
+static void setup_eyes(void);
+static void setup_bars(void);
+static void draw_marquee(int frame);
+static void draw_clock(int frame);
+static void draw_eyes(int frame);
+static void draw_fade(int frame);
+static void draw_fft_bars(int frame);
+static void draw_fft_mirror(int frame);
+static void draw_fft_vu(int frame);
+static void draw_fft_stereo(int frame);
+
+// File Globals
+static const sim_scene_t scenes[] = {
+    {"marquee", SIM_MAX_FRAMES, setup_none, draw_marquee},
+    {"clock", 16, setup_none, draw_clock},
+    {"eyes", 32, setup_eyes, draw_eyes},
+    {"fade", 16, setup_none, draw_fade},
+    {"fft_bars", 48, setup_bars, draw_fft_bars},
+    {"fft_mirror", 48, setup_bars, draw_fft_mirror},
+    {"fft_vu", 48, setup_bars, draw_fft_vu},
+    {"fft_stereo", 48, setup_bars, draw_fft_stereo},
+};
+static animation_frame_t eye_frames[] = {
+    {.id = BITMAP_EYE_OPEN, .hold_cnt = 6},
+    {.id = BITMAP_EYE_OPENING, .hold_cnt = 2},
+    {.id = BITMAP_EYE_CLOSED, .hold_cnt = 2},
+    {.id = BITMAP_EYE_OPENING, .hold_cnt = 2},
+    {.id = BITMAP_EYE_LEFT, .hold_cnt = 6},
+    {.id = BITMAP_EYE_RIGHT, .hold_cnt = 6},
+};
+static animation_sequence_t eye_sequence;
+static fft_bars_t bars;
+static frame_buffer_t latched_frame;
+static uint32_t shown_sequence;
+static uint64_t frame_ns[SIM_MAX_FRAMES];
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Stub display task
+static void reset_display(void)
+{
+    buffer_reset(&display_buffer);
+    memcpy(&latched_frame, buffer_get_read_buffer(&display_buffer), sizeof(frame_buffer_t));
+    shown_sequence = 0;
+}
+
+static void latch_frame(void)
+{
+    // Same as latch_frame() in Display_task.c
+    if (buffer_start_of_frame(&display_buffer))
+    {
+        memcpy(&latched_frame, buffer_get_read_buffer(&display_buffer), sizeof(frame_buffer_t));
+    }
+    shown_sequence = buffer_get_read_sequence(&display_buffer);
+}
+
+static int pixel_level(const frame_buffer_t *frame, int x, int y)
+{
+    // Independent of FrameBuffer.c: the shift register bit of each pixel
+    int level = 0;
+    for (int p = 0; p < frame->depth; p++)
+    {
+        const uint8_t *row = frame_plane_row((frame_buffer_t *)frame, p, y);
+#if defined(CONFIG_DEV_BOARD_DISPLAY)
+        // Active low, column 0 is bit 0 of the last byte
+        int on = !(row[FRAME_BUF_COL_BYTES - 1 - x / 8] & (1 << (x % 8)));
+#elif defined(CONFIG_FORM_FACTOR_DISPLAY)
+        int on = (row[x / 8] & (0x80 >> (x % 8))) != 0;
+#endif
+        level = (level << 1) | on;
+    }
+    return level;
+}
+
+static int frame_to_text(const frame_buffer_t *frame, int index, char *out)
+{
+    int max_level = (1 << frame->depth) - 1;
+    int n = sprintf(out, "# frame %d depth %d\n", index, frame->depth);
+    for (int y = 0; y < FRAME_BUF_ROWS; y++)
+    {
+        for (int x = 0; x < FRAME_BUF_COLS; x++)
+        {
+            int level = pixel_level(frame, x, y);
+            out[n++] = (level == 0) ? '.' : (level == max_level) ? '#' : "0123456789abcde"[level];
+        }
+        out[n++] = '\n';
+    }
+    out[n] = '\0';
+    return n;
+}
+
+static int write_ppm(const char *dir, const char *scene, int index, const frame_buffer_t *frame)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s_%03d.ppm", dir, scene, index);
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return -1;
+    }
+
+    // Red LEDs with a dark gap between them
+    int max_level = (1 << frame->depth) - 1;
+    fprintf(f, "P6\n%d %d\n255\n", FRAME_BUF_COLS * SIM_PPM_SCALE, FRAME_BUF_ROWS * SIM_PPM_SCALE);
+    for (int py = 0; py < FRAME_BUF_ROWS * SIM_PPM_SCALE; py++)
+    {
+        for (int px = 0; px < FRAME_BUF_COLS * SIM_PPM_SCALE; px++)
+        {
+            int edge = (px % SIM_PPM_SCALE == SIM_PPM_SCALE - 1) || (py % SIM_PPM_SCALE == SIM_PPM_SCALE - 1);
+            int level = edge ? 0 : pixel_level(frame, px / SIM_PPM_SCALE, py / SIM_PPM_SCALE);
+            uint8_t rgb[3] = {(uint8_t)(16 + 239 * level / max_level), 0, 0};
+            fwrite(rgb, 1, sizeof(rgb), f);
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+static char *read_file(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        return NULL;
+    }
+    char *buf = malloc(SIM_SCENE_TEXT + 1);
+    size_t n = fread(buf, 1, SIM_SCENE_TEXT, f);
+    buf[n] = '\0';
+    fclose(f);
+    return buf;
+}
+
+static int check_golden(const char *dir, const char *scene, const char *text, int update)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s/%s.txt", dir, SIM_BOARD, scene);
+    if (update)
+    {
+        FILE *f = fopen(path, "w");
+        if (f == NULL)
+        {
+            fprintf(stderr, "Failed to open %s\n", path);
+            return -1;
+        }
+        fputs(text, f);
+        fclose(f);
+        return 0;
+    }
+
+    char *golden = read_file(path);
+    if (golden == NULL)
+    {
+        fprintf(stderr, "FAIL %s: no golden file %s\n", scene, path);
+        return -1;
+    }
+    int ret = 0;
+    if (strcmp(golden, text) != 0)
+    {
+        // Report the first line that differs
+        int line = 1;
+        const char *a = golden;
+        const char *b = text;
+        while (*a && *a == *b)
+        {
+            line += (*a == '\n');
+            a++;
+            b++;
+        }
+        fprintf(stderr, "FAIL %s: differs from %s at line %d\n", scene, path, line);
+        ret = -1;
+    }
+    free(golden);
+    return ret;
+}
+
+// Scenes
+static void setup_none(void)
+{
+}
+
+static void setup_eyes(void)
+{
+    animation_sequence_init(&eye_sequence, eye_frames, sizeof(eye_frames) / sizeof(eye_frames[0]));
+}
+
+static void setup_bars(void)
+{
+    fft_bars_init(&bars, SIM_REFRESH_RATE_HZ);
+}
+
+static void draw_marquee(int frame)
+{
+    // Boot text scrolling in from the right, one column per refresh
+    buffer_clear(&display_buffer);
+    draw_str("DAFT PUNK", FRAME_BUF_COLS - frame, 1, &display_buffer);
+    buffer_update(&display_buffer);
+}
+
+static void draw_clock(int frame)
+{
+    // Idle clock, the minutes tick every other refresh so half the frames repeat
+    char time_str[8];
+    snprintf(time_str, sizeof(time_str), "12:%02d", (frame / 2) % 60);
+    buffer_clear(&display_buffer);
+    draw_str(time_str, 1, 1, &display_buffer);
+    buffer_update(&display_buffer);
+}
+
+static void draw_eyes(int frame)
+{
+    (void)frame;
+    buffer_clear(&display_buffer);
+    animation_sequence_draw(&eye_sequence, 2, 0, &display_buffer);
+    animation_sequence_draw(&eye_sequence, FRAME_BUF_COLS / 2 + 2, 0, &display_buffer);
+    animation_sequence_update(&eye_sequence);
+    buffer_update(&display_buffer);
+}
+
+static void draw_fade(int frame)
+{
+    // Diagonal ramp over every level of a 4 bpp frame, moving one step per refresh
+    buffer_clear(&display_buffer);
+    buffer_set_depth(&display_buffer, 4);
+    for (int y = 0; y < FRAME_BUF_ROWS; y++)
+    {
+        for (int x = 0; x < FRAME_BUF_COLS; x++)
+        {
+            buffer_set_pixel_level(&display_buffer, x, y, (uint8_t)((x + y + frame) % 16));
+        }
+    }
+    buffer_update(&display_buffer);
+}
+
+static void step_bars(int frame)
+{
+    // Targets change every third refresh like FFT frames would, a wave
+    // moving across the columns with a beat on the low end
+    if (frame % 3 == 0)
+    {
+        uint16_t heights[FFT_BARS_MAX_BARS];
+        for (int i = 0; i < FFT_BARS_MAX_BARS; i++)
+        {
+            int phase = (i * 5 + frame * 3) % 64;
+            int wave = (phase < 32) ? phase : 64 - phase;
+            int kick = ((frame / 12) % 2 == 0 && i % FFT_BUCKETS < 4) ? FFT_BARS_MAX_HEIGHT / 2 : 0;
+            int height = wave * FFT_BARS_MAX_HEIGHT / 48 + kick;
+            heights[i] = (height > FFT_BARS_MAX_HEIGHT) ? FFT_BARS_MAX_HEIGHT : (uint16_t)height;
+        }
+        fft_bars_set_target(&bars, heights, FFT_BARS_MAX_BARS);
+    }
+    fft_bars_step(&bars);
+}
+
+static void draw_fft_bars(int frame)
+{
+    step_bars(frame);
+    fft_draw_bars(&display_buffer, &bars);
+}
+
+static void draw_fft_mirror(int frame)
+{
+    step_bars(frame);
+    fft_draw_bars_mirror(&display_buffer, &bars);
+}
+
+static void draw_fft_vu(int frame)
+{
+    step_bars(frame);
+    fft_draw_vu(&display_buffer, &bars);
+}
+
+static void draw_fft_stereo(int frame)
+{
+    step_bars(frame);
+    fft_draw_stereo(&display_buffer, &bars);
+}
+
+static void publish_tagged(int tag)
+{
+    buffer_clear(&display_buffer);
+    buffer_set_pixel(&display_buffer, tag, 0);
+    buffer_update(&display_buffer);
+}
+
+static int shown_tag(void)
+{
+    // One refresh through the same latch as the display task
+    latch_frame();
+    for (int x = 0; x < FRAME_BUF_COLS; x++)
+    {
+        if (pixel_level(&latched_frame, x, 0) > 0)
+        {
+            return x;
+        }
+    }
+    return -1;
+}
+
+static int check_queue(int depth)
+{
+    // One frame and two refreshes, then a burst of three and three refreshes
+    static const int expected_tags[FRAME_QUEUE_MAX_DEPTH + 1][5] = {
+        [2] = {1, 1, 4, 4, 4},
+        [3] = {1, 1, 4, 4, 4},
+        [4] = {1, 1, 3, 4, 4},
+    };
+    uint32_t expected_dropped = (depth == 4) ? 1 : 2;
+    uint32_t expected_presented = (depth == 4) ? 3 : 2;
+
+    reset_display();
+    buffer_set_queue_depth(&display_buffer, depth);
+    int tags[5];
+    publish_tagged(1);
+    tags[0] = shown_tag();
+    tags[1] = shown_tag();
+    publish_tagged(2);
+    publish_tagged(3);
+    publish_tagged(4);
+    tags[2] = shown_tag();
+    // The display may only park or go idle once the newest frame is latched
+    bool settled_early = (shown_sequence == buffer_get_sequence(&display_buffer));
+    tags[3] = shown_tag();
+    tags[4] = shown_tag();
+    bool settled = (shown_sequence == buffer_get_sequence(&display_buffer));
+
+    frame_queue_stats_t stats;
+    buffer_get_stats(&display_buffer, &stats);
+    int ret = 0;
+    if (memcmp(tags, expected_tags[depth], sizeof(tags)) != 0 || tags[4] != 4)
+    {
+        fprintf(stderr, "FAIL frame queue depth %d: latched %d %d %d %d %d, the burst has to end on 4\n",
+                depth, tags[0], tags[1], tags[2], tags[3], tags[4]);
+        ret = -1;
+    }
+    if (settled_early != (tags[2] == 4) || !settled)
+    {
+        fprintf(stderr, "FAIL frame queue depth %d: latched sequence %u, newest %u\n",
+                depth, shown_sequence, buffer_get_sequence(&display_buffer));
+        ret = -1;
+    }
+    if (stats.published != 4 || stats.presented != expected_presented || stats.dropped != expected_dropped ||
+        stats.repeated != 5 - expected_presented)
+    {
+        fprintf(stderr, "FAIL frame queue depth %d: published %u, presented %u, dropped %u, repeated %u\n",
+                depth, stats.published, stats.presented, stats.dropped, stats.repeated);
+        ret = -1;
+    }
+    return ret;
+}
+
+static int check_bars_rate(void)
+{
+    // Moving to another refresh rate has to land on the same per step values
+    // as starting out at it, with the time constants kept in ms
+    static fft_bars_t scaled, fresh;
+    fft_bars_init(&scaled, 90);
+    fft_bars_set_smoothing(&scaled, 20, 300);
+    fft_bars_set_peak_hold(&scaled, 250, 24);
+    fft_bars_set_rate(&scaled, 60);
+
+    fft_bars_init(&fresh, 60);
+    fft_bars_set_smoothing(&fresh, 20, 300);
+    fft_bars_set_peak_hold(&fresh, 250, 24);
+
+    if (scaled.attack_q15 != fresh.attack_q15 || scaled.release_q15 != fresh.release_q15 ||
+        scaled.peak_hold_steps != fresh.peak_hold_steps || scaled.peak_fall != fresh.peak_fall)
+    {
+        fprintf(stderr, "FAIL bars rate: attack %u/%u, release %u/%u, hold %u/%u, fall %u/%u\n",
+                scaled.attack_q15, fresh.attack_q15, scaled.release_q15, fresh.release_q15,
+                scaled.peak_hold_steps, fresh.peak_hold_steps, scaled.peak_fall, fresh.peak_fall);
+        return -1;
+    }
+    return 0;
+}
+
+static int run_scene(const sim_scene_t *scene, char *text)
+{
+    reset_display();
+    scene->setup();
+    int n = 0;
+    for (int i = 0; i < scene->frames; i++)
+    {
+        scene->draw(i);
+        latch_frame();
+        n += frame_to_text(&latched_frame, i, &text[n]);
+    }
+    return n;
+}
+
+static void time_scene(const sim_scene_t *scene, int passes)
+{
+    for (int i = 0; i < scene->frames; i++)
+    {
+        frame_ns[i] = UINT64_MAX;
+    }
+    for (int pass = 0; pass < passes; pass++)
+    {
+        reset_display();
+        scene->setup();
+        for (int i = 0; i < scene->frames; i++)
+        {
+            uint64_t start = now_ns();
+            scene->draw(i);
+            uint64_t ns = now_ns() - start;
+            latch_frame();
+            if (ns < frame_ns[i])
+            {
+                frame_ns[i] = ns;
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *golden_dir = NULL;
+    const char *ppm_dir = NULL;
+    const char *csv_path = NULL;
+    int update = 0;
+    int term = 0;
+    int passes = SIM_DEFAULT_PASSES;
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--check") == 0 || strcmp(argv[i], "--update") == 0) && i + 1 < argc)
+        {
+            update = (strcmp(argv[i], "--update") == 0);
+            golden_dir = argv[++i];
+        }
+        else if (strcmp(argv[i], "--ppm") == 0 && i + 1 < argc)
+        {
+            ppm_dir = argv[++i];
+        }
+        else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc)
+        {
+            csv_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--term") == 0)
+        {
+            term = 1;
+        }
+        else if ((passes = atoi(argv[i])) <= 0)
+        {
+            fprintf(stderr, "Usage: %s [--check DIR | --update DIR] [--term] [--ppm DIR] [--csv FILE] [passes]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    FILE *csv = NULL;
+    if (csv_path != NULL)
+    {
+        csv = fopen(csv_path, "w");
+        if (csv == NULL)
+        {
+            fprintf(stderr, "Failed to open %s\n", csv_path);
+            return 1;
+        }
+        fprintf(csv, "scene,frame,ns\n");
+    }
+
+    int ret = 0;
+    for (int depth = 2; depth <= FRAME_QUEUE_MAX_DEPTH; depth++)
+    {
+        if (check_queue(depth) < 0)
+        {
+            ret = 1;
+        }
+    }
+    if (check_bars_rate() < 0)
+    {
+        ret = 1;
+    }
+
+    char *text = malloc(SIM_SCENE_TEXT);
+    printf("Display simulator: %s board, %dx%d, %d passes\n", SIM_BOARD, FRAME_BUF_COLS, FRAME_BUF_ROWS, passes);
+    printf("%-12s %7s %12s %12s %8s\n", "scene", "frames", "mean ns", "worst ns", "golden");
+    for (size_t s = 0; s < sizeof(scenes) / sizeof(scenes[0]); s++)
+    {
+        const sim_scene_t *scene = &scenes[s];
+        run_scene(scene, text);
+        const char *golden = "-";
+        if (golden_dir != NULL)
+        {
+            if (check_golden(golden_dir, scene->name, text, update) < 0)
+            {
+                golden = "FAIL";
+                ret = 1;
+            }
+            else
+            {
+                golden = update ? "updated" : "ok";
+            }
+        }
+        if (term)
+        {
+            fputs(text, stdout);
+        }
+        if (ppm_dir != NULL)
+        {
+            // Second run to get at each latched frame again
+            reset_display();
+            scene->setup();
+            for (int i = 0; i < scene->frames; i++)
+            {
+                scene->draw(i);
+                latch_frame();
+                if (write_ppm(ppm_dir, scene->name, i, &latched_frame) < 0)
+                {
+                    ret = 1;
+                    break;
+                }
+            }
+        }
+
+        time_scene(scene, passes);
+        uint64_t total = 0;
+        uint64_t worst = 0;
+        for (int i = 0; i < scene->frames; i++)
+        {
+            total += frame_ns[i];
+            worst = (frame_ns[i] > worst) ? frame_ns[i] : worst;
+            if (csv != NULL)
+            {
+                fprintf(csv, "%s,%d,%llu\n", scene->name, i, (unsigned long long)frame_ns[i]);
+            }
+        }
+        printf("%-12s %7d %12llu %12llu %8s\n", scene->name, scene->frames,
+               (unsigned long long)(total / scene->frames), (unsigned long long)worst, golden);
+    }
+
+    free(text);
+    if (csv != NULL)
+    {
+        fclose(csv);
+    }
+    return ret;
+}
@@ -0,0 +1,885 @@
+/*
+ * Host benchmark for the FFT pipeline (main/FFT)
+ *
+ * Times fft_execute() for real and complex forward plans created by
+ * fft_init(), and the spectrum bucketing step used by process_fft(), for
+ * power of two sizes between BENCH_MIN_SIZE and BENCH_MAX_SIZE. The bucket
+ * plan is checked against, and timed next to, the original per-bin linear
+ * search it replaced.
+ *
+ * Every engine is run for every size, and the output of each engine other
+ * than split-radix is checked against split-radix, forward and backward, to
+ * within BENCH_ENGINE_TOLERANCE of the peak output magnitude.
+ *
+ * The fixed point real FFT (q15 rows) is checked against the float FFT of
+ * the same int16 samples to within BENCH_FIXED_TOLERANCE of the peak
+ * magnitude, its timing includes copying the input since it runs in place.
+ *
+ * The stereo variant (fft_q15_execute_stereo(), q15 stereo rows) is checked
+ * the same way against one float real FFT per channel, each of half the
+ * plan size. A 16 point input whose last stage outputs sit at the largest
+ * value the stage shifts allow checks that the channel split can't overflow.
+ *
+ * The generated twiddle tables behind the static plans (FFT_tables.c) are
+ * checked against the ones fft_init_engine() and fft_q15_init() compute.
+ *
+ * The mel filterbank is checked by sweeping a tone over the band centers,
+ * each of which has to peak in its own band.
+ *
+ * The decimating front end (FFT_decimator.c) is checked for its gain at the
+ * top display bucket, which has to stay within BENCH_DECIMATOR_PASSBAND_DB,
+ * and for the rejection of a tone that would alias onto it, which has to be
+ * at least BENCH_DECIMATOR_STOPBAND_DB.
+ *
+ * The beat tracker (FFT_beat.c) is fed synthetic bucket frames with a kick
+ * at BENCH_BEAT_BPM over noise, and has to report that tempo to within
+ * BENCH_BEAT_TOLERANCE_BPM. Noise alone must not produce onsets.
+ *
+ * Usage: fft_bench [iterations]
+ */
+#include "FFT.h"
+#include "FFT_fixed.h"
+#include "FFT_spectrum.h"
+#include "FFT_decimator.h"
+#include "FFT_beat.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#else
+#define BENCH_HAVE_TSC 0
+#endif
+
+#define BENCH_MIN_SIZE 256
+#define BENCH_MAX_SIZE 4096
+#define BENCH_SAMPLE_RATE 44100.0
+#define BENCH_DEFAULT_ITERATIONS 2000
+#define BENCH_RUNS 7
+#define BENCH_SPECTRUM_TOLERANCE 1e-4
+#define BENCH_ENGINE_TOLERANCE 1e-5
+#define BENCH_FIXED_TOLERANCE 2e-3
+#define BENCH_FILTERBANK_SIZE 1024
+#define BENCH_FILTERBANK_MIN_FREQ 40.0
+#define BENCH_FILTERBANK_MAX_FREQ 8000.0
+#define BENCH_DECIMATOR_SAMPLES 16384
+#define BENCH_DECIMATOR_PASSBAND_DB 1.0
+#define BENCH_DECIMATOR_STOPBAND_DB 40.0
+#define BENCH_BEAT_FRAME_RATE (BENCH_SAMPLE_RATE / 2 / 256)
+#define BENCH_BEAT_BPM 123.0
+#define BENCH_BEAT_TOLERANCE_BPM 2
+#define BENCH_BEAT_SECONDS 20
+#define BENCH_BEAT_MIN_LEVEL (1 << 14)
+
+typedef struct
+{
+    uint32_t count;
+    size_t bytes;
+} alloc_stats_t;
+
+typedef struct
+{
+    double ns;
+    double cycles;
+} bench_time_t;
+
+typedef void (*bench_func_t)(void *ctx);
+
+// File Globals
+static alloc_stats_t alloc_stats;
+
+static const char *ENGINE_NAMES[] = {
+    "split",
+    "radix4",
+};
+
+// Heap wrappers (linked with -Wl,--wrap=<func>)
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_malloc(size_t size)
+{
+    alloc_stats.count++;
+    alloc_stats.bytes += size;
+    return __real_malloc(size);
+}
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+    alloc_stats.count++;
+    alloc_stats.bytes += nmemb * size;
+    return __real_calloc(nmemb, size);
+}
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    alloc_stats.count++;
+    alloc_stats.bytes += size;
+    return __real_realloc(ptr, size);
+}
+void __wrap_free(void *ptr)
+{
+    __real_free(ptr);
+}
+
+// Private Functions
+static inline uint64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static inline uint64_t now_cycles()
+{
+#if BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+static bench_time_t bench_run(bench_func_t func, void *ctx, int iterations)
+{
+    double ns[BENCH_RUNS];
+    double cycles[BENCH_RUNS];
+
+    // Warm up caches and branch predictors
+    for (int i = 0; i < iterations / 10 + 1; i++)
+    {
+        func(ctx);
+    }
+
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        uint64_t t0 = now_ns();
+        uint64_t c0 = now_cycles();
+        for (int i = 0; i < iterations; i++)
+        {
+            func(ctx);
+        }
+        uint64_t c1 = now_cycles();
+        uint64_t t1 = now_ns();
+        ns[run] = (double)(t1 - t0) / iterations;
+        cycles[run] = (double)(c1 - c0) / iterations;
+    }
+
+    qsort(ns, BENCH_RUNS, sizeof(double), compare_double);
+    qsort(cycles, BENCH_RUNS, sizeof(double), compare_double);
+    bench_time_t result = {
+        .ns = ns[BENCH_RUNS / 2],
+        .cycles = cycles[BENCH_RUNS / 2],
+    };
+    return result;
+}
+
+static void fill_test_signal(float *buf, int n)
+{
+    // A few tones plus noise, roughly at 16 bit PCM scale
+    srand(1234);
+    for (int i = 0; i < n; i++)
+    {
+        double t = i / BENCH_SAMPLE_RATE;
+        double s = 8000.0 * sin(2.0 * M_PI * 110.0 * t) +
+                   4000.0 * sin(2.0 * M_PI * 1000.0 * t) +
+                   2000.0 * sin(2.0 * M_PI * 5000.0 * t);
+        s += (rand() % 2001) - 1000;
+        buf[i] = (float)s;
+    }
+}
+
+static void bench_fft_execute(void *ctx)
+{
+    fft_execute((fft_config_t *)ctx);
+}
+
+struct spectrum_ctx
+{
+    fft_config_t *plan;
+    fft_bucket_plan_t bucket_plan;
+    float total_time;
+    float bucket_mags[FFT_BUCKETS];
+};
+static void bench_spectrum(void *ctx)
+{
+    struct spectrum_ctx *sctx = (struct spectrum_ctx *)ctx;
+    fft_bucket_plan_apply(&sctx->bucket_plan, sctx->plan->output, sctx->bucket_mags);
+}
+
+// Original process_fft() bucketing: per-bin linear search and double sqrt/pow
+static void reference_bucket_mags(const float *fft_output, int fft_size, float total_time, float bucket_mags[])
+{
+    float freq;
+    float mag;
+
+    for (int i = 0; i < FFT_BUCKETS; i++)
+    {
+        bucket_mags[i] = 0.0;
+    }
+    for (int k = 1; k < fft_size / 2; k++)
+    {
+        freq = k * 1.0 / total_time;
+        if (freq > fft_bucket_ranges[FFT_BUCKETS - 1])
+        {
+            break;
+        }
+        mag = sqrt(pow(fft_output[2 * k], 2) + pow(fft_output[2 * k + 1], 2));
+
+        int bidx;
+        for (bidx = 0; bidx < FFT_BUCKETS; bidx++)
+        {
+            if (freq < fft_bucket_ranges[bidx])
+            {
+                break;
+            }
+        }
+        if (bidx >= FFT_BUCKETS)
+        {
+            bidx = FFT_BUCKETS - 1;
+        }
+        if (mag > bucket_mags[bidx])
+        {
+            bucket_mags[bidx] = mag;
+        }
+    }
+}
+static void bench_spectrum_reference(void *ctx)
+{
+    struct spectrum_ctx *sctx = (struct spectrum_ctx *)ctx;
+    reference_bucket_mags(sctx->plan->output, sctx->plan->size, sctx->total_time, sctx->bucket_mags);
+}
+
+static int check_spectrum(struct spectrum_ctx *sctx)
+{
+    float ref[FFT_BUCKETS];
+    reference_bucket_mags(sctx->plan->output, sctx->plan->size, sctx->total_time, ref);
+    bench_spectrum(sctx);
+    for (int i = 0; i < FFT_BUCKETS; i++)
+    {
+        if (fabsf(sctx->bucket_mags[i] - ref[i]) > BENCH_SPECTRUM_TOLERANCE * (ref[i] + 1.0f))
+        {
+            printf("Bucket %d mismatch for size %d: %f != %f\n", i, sctx->plan->size, sctx->bucket_mags[i], ref[i]);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// Runs one transform with the given engine on a copy of input, returns the output
+static float *run_engine(fft_engine_t engine, fft_type_t type, fft_direction_t direction, int size, const float *input)
+{
+    int len = (type == FFT_REAL) ? size : 2 * size;
+    fft_config_t *plan = fft_init_engine(size, type, direction, engine, NULL, NULL);
+    if (plan == NULL)
+    {
+        return NULL;
+    }
+    float *output = (float *)malloc(len * sizeof(float));
+    memcpy(plan->input, input, len * sizeof(float));
+    fft_execute(plan);
+    memcpy(output, plan->output, len * sizeof(float));
+    fft_destroy(plan);
+    return output;
+}
+
+static int check_engine(fft_engine_t engine, fft_type_t type, int size)
+{
+    int len = (type == FFT_REAL) ? size : 2 * size;
+    float *input = (float *)malloc(len * sizeof(float));
+    fill_test_signal(input, len);
+
+    int ret = 0;
+    fft_direction_t directions[] = {FFT_FORWARD, FFT_BACKWARD};
+    for (int d = 0; d < 2; d++)
+    {
+        float *ref = run_engine(FFT_ENGINE_SPLIT_RADIX, type, directions[d], size, input);
+        float *out = run_engine(engine, type, directions[d], size, input);
+        if (ref == NULL || out == NULL)
+        {
+            printf("Failed to create %s plan of size %d\n", ENGINE_NAMES[engine], size);
+            ret = -1;
+        }
+        else
+        {
+            double peak = 0.0;
+            double max_err = 0.0;
+            for (int i = 0; i < len; i++)
+            {
+                peak = fmax(peak, fabs(ref[i]));
+                max_err = fmax(max_err, fabs(out[i] - ref[i]));
+            }
+            if (max_err > BENCH_ENGINE_TOLERANCE * peak)
+            {
+                printf("%s %s %s size %d differs from split-radix: max error %g, peak %g\n",
+                       ENGINE_NAMES[engine],
+                       (type == FFT_REAL) ? "real" : "complex",
+                       (directions[d] == FFT_FORWARD) ? "forward" : "backward",
+                       size, max_err, peak);
+                ret = -1;
+            }
+        }
+        free(ref);
+        free(out);
+    }
+    free(input);
+    return ret;
+}
+
+static int bench_plan(fft_engine_t engine, fft_type_t type, int size, int iterations)
+{
+    alloc_stats_t init_allocs;
+    alloc_stats_t exec_allocs;
+
+    if (engine != FFT_ENGINE_SPLIT_RADIX && check_engine(engine, type, size) < 0)
+    {
+        return -1;
+    }
+
+    memset(&alloc_stats, 0, sizeof(alloc_stats));
+    fft_config_t *plan = fft_init_engine(size, type, FFT_FORWARD, engine, NULL, NULL);
+    init_allocs = alloc_stats;
+    if (plan == NULL)
+    {
+        printf("Failed to create %s plan of size %d\n", (type == FFT_REAL) ? "real" : "complex", size);
+        return -1;
+    }
+
+    int input_len = (type == FFT_REAL) ? size : 2 * size;
+    fill_test_signal(plan->input, input_len);
+
+    memset(&alloc_stats, 0, sizeof(alloc_stats));
+    bench_time_t fft_time = bench_run(bench_fft_execute, plan, iterations);
+    exec_allocs = alloc_stats;
+
+    // Real plans produce N/2 bins, complex plans N bins
+    int bins = (type == FFT_REAL) ? size / 2 : size;
+    char cycles_str[16] = "-";
+    if (BENCH_HAVE_TSC)
+    {
+        snprintf(cycles_str, sizeof(cycles_str), "%.2f", fft_time.cycles / bins);
+    }
+
+    char spectrum_str[16] = "-";
+    char reference_str[16] = "-";
+    int ret = 0;
+    if (type == FFT_REAL)
+    {
+        struct spectrum_ctx sctx = {
+            .plan = plan,
+            .total_time = size / BENCH_SAMPLE_RATE,
+        };
+        fft_bucket_plan_init(&sctx.bucket_plan, fft_bucket_ranges, FFT_BUCKETS, size, BENCH_SAMPLE_RATE);
+        fft_execute(plan);
+        ret = check_spectrum(&sctx);
+
+        bench_time_t spectrum_time = bench_run(bench_spectrum, &sctx, iterations);
+        bench_time_t reference_time = bench_run(bench_spectrum_reference, &sctx, iterations);
+        snprintf(spectrum_str, sizeof(spectrum_str), "%.0f", spectrum_time.ns);
+        snprintf(reference_str, sizeof(reference_str), "%.0f", reference_time.ns);
+    }
+
+    printf("%-7s %-8s %5d %12.0f %10s %7u/%-8zu %11u %12s %12s\n",
+           ENGINE_NAMES[engine],
+           (type == FFT_REAL) ? "real" : "complex",
+           size,
+           fft_time.ns,
+           cycles_str,
+           init_allocs.count,
+           init_allocs.bytes,
+           exec_allocs.count,
+           spectrum_str,
+           reference_str);
+
+    fft_destroy(plan);
+    return ret;
+}
+
+struct fixed_ctx
+{
+    fft_q15_config_t *plan;
+    const int16_t *samples;
+    int exponent;
+    fft_bucket_plan_t bucket_plan;
+    uint32_t bucket_mags[FFT_BUCKETS];
+};
+static void bench_fixed_execute(void *ctx)
+{
+    struct fixed_ctx *fctx = (struct fixed_ctx *)ctx;
+    memcpy(fctx->plan->data, fctx->samples, fctx->plan->size * sizeof(int16_t));
+    fctx->exponent = fft_q15_execute(fctx->plan);
+}
+static void bench_fixed_spectrum(void *ctx)
+{
+    struct fixed_ctx *fctx = (struct fixed_ctx *)ctx;
+    fft_bucket_plan_apply_q(&fctx->bucket_plan, fctx->plan->data, fctx->exponent, 256, fctx->bucket_mags);
+}
+
+static int check_fixed(struct fixed_ctx *fctx)
+{
+    int size = fctx->plan->size;
+    float *input = (float *)malloc(size * sizeof(float));
+    for (int i = 0; i < size; i++)
+    {
+        input[i] = fctx->samples[i];
+    }
+    float *ref = run_engine(FFT_ENGINE_SPLIT_RADIX, FFT_REAL, FFT_FORWARD, size, input);
+    free(input);
+
+    bench_fixed_execute(fctx);
+    double scale = ldexp(1.0, fctx->exponent);
+    double peak = 0.0;
+    double max_err = 0.0;
+    for (int i = 0; i < size; i++)
+    {
+        peak = fmax(peak, fabs(ref[i]));
+        max_err = fmax(max_err, fabs(fctx->plan->data[i] * scale - ref[i]));
+    }
+    free(ref);
+    if (max_err > BENCH_FIXED_TOLERANCE * peak)
+    {
+        printf("q15 size %d differs from float: max error %g, peak %g\n", size, max_err, peak);
+        return -1;
+    }
+    return 0;
+}
+
+static void bench_fixed_stereo_execute(void *ctx)
+{
+    struct fixed_ctx *fctx = (struct fixed_ctx *)ctx;
+    memcpy(fctx->plan->data, fctx->samples, fctx->plan->size * sizeof(int16_t));
+    fctx->exponent = fft_q15_execute_stereo(fctx->plan);
+}
+
+static int check_fixed_stereo(struct fixed_ctx *fctx)
+{
+    // samples holds size / 2 interleaved left/right pairs
+    int half = fctx->plan->size / 2;
+    float *input = (float *)malloc(half * sizeof(float));
+    float *ref[2];
+    for (int c = 0; c < 2; c++)
+    {
+        for (int i = 0; i < half; i++)
+        {
+            input[i] = fctx->samples[2 * i + c];
+        }
+        ref[c] = run_engine(FFT_ENGINE_SPLIT_RADIX, FFT_REAL, FFT_FORWARD, half, input);
+    }
+    free(input);
+
+    bench_fixed_stereo_execute(fctx);
+    double scale = ldexp(1.0, fctx->exponent);
+    double peak = 0.0;
+    double max_err = 0.0;
+    for (int c = 0; c < 2; c++)
+    {
+        const int16_t *out = fctx->plan->data + c * half;
+        for (int i = 0; i < half; i++)
+        {
+            peak = fmax(peak, fabs(ref[c][i]));
+            max_err = fmax(max_err, fabs(out[i] * scale - ref[c][i]));
+        }
+        free(ref[c]);
+    }
+    if (max_err > BENCH_FIXED_TOLERANCE * peak)
+    {
+        printf("q15 stereo size %d differs from float: max error %g, peak %g\n", fctx->plan->size, max_err, peak);
+        return -1;
+    }
+    return 0;
+}
+
+static int check_fixed_stereo_headroom(void)
+{
+    // Left channel pattern whose last stage outputs reach (1 + sqrt(2)) * 8190
+    // in the two bins the left channel's bin 1 is summed from
+    static const int16_t samples[16] = {
+        8190, 0, 8190, 0, 0, 0, -8190, 0, -8190, 0, -8190, 0, 0, 0, 8190, 0,
+    };
+    struct fixed_ctx fctx = {.samples = samples};
+    fctx.plan = fft_q15_init(16, NULL);
+    if (fctx.plan == NULL)
+    {
+        printf("Failed to create q15 plan of size 16\n");
+        return -1;
+    }
+    int ret = check_fixed_stereo(&fctx);
+    fft_q15_destroy(fctx.plan);
+    return ret;
+}
+
+static int bench_fixed(int size, int iterations)
+{
+    struct fixed_ctx fctx = {0};
+    float *signal = (float *)malloc(size * sizeof(float));
+    int16_t *samples = (int16_t *)malloc(size * sizeof(int16_t));
+    fill_test_signal(signal, size);
+    for (int i = 0; i < size; i++)
+    {
+        samples[i] = (int16_t)signal[i];
+    }
+    free(signal);
+    fctx.samples = samples;
+
+    memset(&alloc_stats, 0, sizeof(alloc_stats));
+    fctx.plan = fft_q15_init(size, NULL);
+    alloc_stats_t init_allocs = alloc_stats;
+    if (fctx.plan == NULL)
+    {
+        printf("Failed to create q15 plan of size %d\n", size);
+        free(samples);
+        return -1;
+    }
+    int ret = check_fixed(&fctx);
+
+    memset(&alloc_stats, 0, sizeof(alloc_stats));
+    bench_time_t fft_time = bench_run(bench_fixed_execute, &fctx, iterations);
+    alloc_stats_t exec_allocs = alloc_stats;
+
+    fft_bucket_plan_init(&fctx.bucket_plan, fft_bucket_ranges, FFT_BUCKETS, size, BENCH_SAMPLE_RATE);
+    bench_time_t spectrum_time = bench_run(bench_fixed_spectrum, &fctx, iterations);
+
+    char cycles_str[16] = "-";
+    if (BENCH_HAVE_TSC)
+    {
+        snprintf(cycles_str, sizeof(cycles_str), "%.2f", fft_time.cycles / (size / 2));
+    }
+    printf("%-7s %-8s %5d %12.0f %10s %7u/%-8zu %11u %12.0f %12s\n",
+           "q15", "real", size, fft_time.ns, cycles_str,
+           init_allocs.count, init_allocs.bytes, exec_allocs.count,
+           spectrum_time.ns, "-");
+
+    // Same samples read as size / 2 stereo pairs, so left and right differ
+    if (check_fixed_stereo(&fctx) < 0)
+    {
+        ret = -1;
+    }
+    fft_time = bench_run(bench_fixed_stereo_execute, &fctx, iterations);
+    if (BENCH_HAVE_TSC)
+    {
+        snprintf(cycles_str, sizeof(cycles_str), "%.2f", fft_time.cycles / (size / 2));
+    }
+    printf("%-7s %-8s %5d %12.0f %10s %16s %11s %12s %12s\n",
+           "q15", "stereo", size, fft_time.ns, cycles_str, "-", "-", "-", "-");
+
+    fft_q15_destroy(fctx.plan);
+    free(samples);
+    return ret;
+}
+
+static int check_static_tables(int size, const float *radix4_table, size_t radix4_len, const int16_t *q15_table, size_t q15_len)
+{
+    int ret = 0;
+    fft_config_t *plan = fft_init_engine(size, FFT_REAL, FFT_FORWARD, FFT_ENGINE_RADIX4, NULL, NULL);
+    for (size_t i = 0; i < radix4_len; i++)
+    {
+        if (plan->twiddle_factors[i] != radix4_table[i])
+        {
+            printf("Static radix-4 table for size %d differs at %zu: %.9g != %.9g\n", size, i, radix4_table[i], plan->twiddle_factors[i]);
+            ret = -1;
+            break;
+        }
+    }
+    fft_destroy(plan);
+
+    fft_q15_config_t *q15_plan = fft_q15_init(size, NULL);
+    for (size_t i = 0; i < q15_len; i++)
+    {
+        if (q15_plan->twiddle_factors[i] != q15_table[i])
+        {
+            printf("Static q15 table for size %d differs at %zu: %d != %d\n", size, i, q15_table[i], q15_plan->twiddle_factors[i]);
+            ret = -1;
+            break;
+        }
+    }
+    fft_q15_destroy(q15_plan);
+
+    printf("Static tables for size %d: %s (%zu B radix-4, %zu B q15)\n", size, (ret == 0) ? "match" : "MISMATCH",
+           radix4_len * sizeof(float), q15_len * sizeof(int16_t));
+    return ret;
+}
+
+struct filterbank_ctx
+{
+    fft_filterbank_t fb;
+    const float *fft_output;
+    float band_mags[FFT_BUCKETS];
+};
+static void bench_filterbank(void *ctx)
+{
+    struct filterbank_ctx *fctx = (struct filterbank_ctx *)ctx;
+    fft_filterbank_apply(&fctx->fb, fctx->fft_output, fctx->band_mags);
+}
+
+static int check_filterbank(int iterations)
+{
+    // Same bins as the firmware: FFT_N of 1024 after decimating by 2
+    int size = BENCH_FILTERBANK_SIZE;
+    double rate = BENCH_SAMPLE_RATE / 2;
+    struct filterbank_ctx fctx;
+    if (fft_filterbank_init(&fctx.fb, FFT_BUCKETS, BENCH_FILTERBANK_MIN_FREQ, BENCH_FILTERBANK_MAX_FREQ, size, rate) < 0)
+    {
+        printf("Failed to create mel filterbank\n");
+        return -1;
+    }
+
+    int ret = 0;
+    int min_bins = size;
+    int weights = 0;
+    float *input = (float *)malloc(size * sizeof(float));
+    double mel_min = 2595.0 * log10(1.0 + BENCH_FILTERBANK_MIN_FREQ / 700.0);
+    double mel_step = (2595.0 * log10(1.0 + fctx.fb.f_max / 700.0) - mel_min) / (FFT_BUCKETS + 1);
+    for (int b = 0; b < FFT_BUCKETS; b++)
+    {
+        min_bins = (fctx.fb.k_count[b] < min_bins) ? fctx.fb.k_count[b] : min_bins;
+        weights += fctx.fb.k_count[b];
+
+        double center = 700.0 * (pow(10.0, (mel_min + (b + 1) * mel_step) / 2595.0) - 1.0);
+        for (int i = 0; i < size; i++)
+        {
+            input[i] = (float)(8000.0 * sin(2.0 * M_PI * center * i / rate));
+        }
+        float *output = run_engine(FFT_ENGINE_SPLIT_RADIX, FFT_REAL, FFT_FORWARD, size, input);
+        fctx.fft_output = output;
+        bench_filterbank(&fctx);
+        int peak = 0;
+        for (int i = 1; i < FFT_BUCKETS; i++)
+        {
+            peak = (fctx.band_mags[i] > fctx.band_mags[peak]) ? i : peak;
+        }
+        if (peak != b)
+        {
+            printf("Mel band %d (%.0f Hz) peaks in band %d\n", b, center, peak);
+            ret = -1;
+        }
+
+        if (b == FFT_BUCKETS - 1)
+        {
+            bench_time_t time = bench_run(bench_filterbank, &fctx, iterations);
+            printf("Mel filterbank: %d bands, %d weights, at least %d bins per band, %.0f ns/frame: %s\n",
+                   FFT_BUCKETS, weights, min_bins, time.ns, (ret == 0) ? "ok" : "FAIL");
+        }
+        free(output);
+    }
+    free(input);
+    return ret;
+}
+
+struct decimator_ctx
+{
+    fft_decimator_t dec;
+    int16_t *samples;
+    int16_t *output;
+    int count;
+};
+
+static void bench_decimator(void *ctx)
+{
+    struct decimator_ctx *dctx = (struct decimator_ctx *)ctx;
+    int count = 0;
+    for (int i = 0; i < BENCH_DECIMATOR_SAMPLES; i++)
+    {
+        if (fft_decimator_push(&dctx->dec, dctx->samples[i], &dctx->output[count]))
+        {
+            count++;
+        }
+    }
+    dctx->count = count;
+}
+
+// Gain in dB of a full scale / 2 tone, skipping the filter's start up
+static double decimator_gain_db(struct decimator_ctx *dctx, int factor, double freq)
+{
+    double amplitude = 16384.0;
+    for (int i = 0; i < BENCH_DECIMATOR_SAMPLES; i++)
+    {
+        dctx->samples[i] = (int16_t)lrint(amplitude * sin(2.0 * M_PI * freq * i / BENCH_SAMPLE_RATE));
+    }
+    fft_decimator_set_factor(&dctx->dec, factor);
+    bench_decimator(dctx);
+
+    double sum_sq = 0.0;
+    int skip = FFT_DECIMATOR_TAPS_PER_PHASE;
+    for (int i = skip; i < dctx->count; i++)
+    {
+        sum_sq += (double)dctx->output[i] * dctx->output[i];
+    }
+    double rms = sqrt(sum_sq / (dctx->count - skip));
+    return 20.0 * log10(fmax(rms, 1e-3) / (amplitude / sqrt(2.0)));
+}
+
+static int check_decimator(int iterations)
+{
+    struct decimator_ctx dctx;
+    dctx.samples = (int16_t *)malloc(BENCH_DECIMATOR_SAMPLES * sizeof(int16_t));
+    dctx.output = (int16_t *)malloc(BENCH_DECIMATOR_SAMPLES * sizeof(int16_t));
+    fft_decimator_init(&dctx.dec, 1);
+
+    int ret = 0;
+    int factors[] = {2, 4};
+    double top = fft_bucket_ranges[FFT_BUCKETS - 1];
+    for (size_t f = 0; f < sizeof(factors) / sizeof(factors[0]); f++)
+    {
+        int factor = factors[f];
+        double out_rate = BENCH_SAMPLE_RATE / factor;
+        // Highest frequency still covered at this rate, and its image
+        double pass = fmin(top, 0.34 * out_rate);
+        double stop = out_rate - pass;
+        double pass_db = decimator_gain_db(&dctx, factor, pass);
+        double stop_db = decimator_gain_db(&dctx, factor, stop);
+
+        fft_decimator_set_factor(&dctx.dec, factor);
+        bench_time_t time = bench_run(bench_decimator, &dctx, iterations / 10 + 1);
+        bool ok = fabs(pass_db) <= BENCH_DECIMATOR_PASSBAND_DB && -stop_db >= BENCH_DECIMATOR_STOPBAND_DB;
+        printf("Decimator by %d: %.2f dB at %.0f Hz, %.1f dB at %.0f Hz, %.2f ns/sample: %s\n",
+               factor, pass_db, pass, stop_db, stop, time.ns / BENCH_DECIMATOR_SAMPLES, ok ? "ok" : "FAIL");
+        if (!ok)
+        {
+            ret = -1;
+        }
+    }
+
+    free(dctx.samples);
+    free(dctx.output);
+    return ret;
+}
+
+struct beat_ctx
+{
+    fft_beat_t beat;
+    uint32_t mags[FFT_BUCKETS];
+    int onsets;
+};
+
+static void bench_beat(void *ctx)
+{
+    struct beat_ctx *bctx = (struct beat_ctx *)ctx;
+    bctx->onsets += fft_beat_update(&bctx->beat, bctx->mags, FFT_BUCKETS);
+}
+
+// Frames of noise with a decaying low frequency kick every beat (0 BPM for none)
+static void run_beat_track(struct beat_ctx *bctx, double bpm)
+{
+    srand(4321);
+    fft_beat_init(&bctx->beat, BENCH_BEAT_MIN_LEVEL);
+    fft_beat_set_rate(&bctx->beat, BENCH_BEAT_FRAME_RATE);
+    bctx->onsets = 0;
+    double period = (bpm > 0) ? 60.0 * BENCH_BEAT_FRAME_RATE / bpm : 0.0;
+    double next_beat = period;
+    double kick = 0.0;
+    for (int frame = 0; frame < BENCH_BEAT_SECONDS * BENCH_BEAT_FRAME_RATE; frame++)
+    {
+        kick *= 0.7;
+        if (period > 0 && frame >= next_beat)
+        {
+            kick = 1.0;
+            next_beat += period;
+        }
+        for (int i = 0; i < FFT_BUCKETS; i++)
+        {
+            double noise = 200000.0 * (0.5 + (rand() % 1000) / 1000.0);
+            double level = (i < FFT_BUCKETS / 4) ? 4000000.0 * kick : 0.0;
+            bctx->mags[i] = (uint32_t)(noise + level);
+        }
+        bench_beat(bctx);
+    }
+}
+
+static int check_beat(int iterations)
+{
+    struct beat_ctx bctx;
+    run_beat_track(&bctx, 0.0);
+    int noise_onsets = bctx.onsets;
+    run_beat_track(&bctx, BENCH_BEAT_BPM);
+    uint32_t bpm = fft_beat_bpm(&bctx.beat);
+    bench_time_t time = bench_run(bench_beat, &bctx, iterations);
+
+    bool ok = noise_onsets == 0 && fabs((double)bpm - BENCH_BEAT_BPM) <= BENCH_BEAT_TOLERANCE_BPM;
+    printf("Beat tracker: %u BPM for %.0f BPM, %d onsets on noise, %.0f ns/frame: %s\n",
+           bpm, BENCH_BEAT_BPM, noise_onsets, time.ns, ok ? "ok" : "FAIL");
+    return ok ? 0 : -1;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = BENCH_DEFAULT_ITERATIONS;
+    if (argc > 1)
+    {
+        iterations = atoi(argv[1]);
+        if (iterations <= 0)
+        {
+            fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    int ret = 0;
+#if FFT_TABLES_HAVE_1024
+    if (check_static_tables(1024, fft_radix4_real_twiddles_1024, sizeof(fft_radix4_real_twiddles_1024) / sizeof(float),
+                            fft_q15_twiddles_1024, sizeof(fft_q15_twiddles_1024) / sizeof(int16_t)) < 0)
+    {
+        ret = 1;
+    }
+#endif
+#if FFT_TABLES_HAVE_2048
+    if (check_static_tables(2048, fft_radix4_real_twiddles_2048, sizeof(fft_radix4_real_twiddles_2048) / sizeof(float),
+                            fft_q15_twiddles_2048, sizeof(fft_q15_twiddles_2048) / sizeof(int16_t)) < 0)
+    {
+        ret = 1;
+    }
+#endif
+    if (check_filterbank(iterations) < 0)
+    {
+        ret = 1;
+    }
+    if (check_decimator(iterations) < 0)
+    {
+        ret = 1;
+    }
+    if (check_beat(iterations) < 0)
+    {
+        ret = 1;
+    }
+    if (check_fixed_stereo_headroom() < 0)
+    {
+        ret = 1;
+    }
+
+    printf("FFT benchmark: %d iterations, median of %d runs\n", iterations, BENCH_RUNS);
+    printf("cyc/bin: %s\n", BENCH_HAVE_TSC ? "TSC cycles per output bin" : "not available on this host");
+    printf("%-7s %-8s %5s %12s %10s %16s %11s %12s %12s\n",
+           "engine", "type", "size", "ns/xform", "cyc/bin", "init allocs/B", "exec allocs", "spectrum ns", "ref ns");
+
+    fft_type_t types[] = {FFT_REAL, FFT_COMPLEX};
+    fft_engine_t engines[] = {FFT_ENGINE_SPLIT_RADIX, FFT_ENGINE_RADIX4};
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++)
+    {
+        for (int size = BENCH_MIN_SIZE; size <= BENCH_MAX_SIZE; size *= 2)
+        {
+            for (size_t e = 0; e < sizeof(engines) / sizeof(engines[0]); e++)
+            {
+                if (bench_plan(engines[e], types[t], size, iterations) < 0)
+                {
+                    ret = 1;
+                }
+            }
+            if (types[t] == FFT_REAL && bench_fixed(size, iterations) < 0)
+            {
+                ret = 1;
+            }
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,6 @@
+#pragma once
+// Host stand-in for the generated ESP-IDF sdkconfig.h. The display type is
+// selected by the host CMake project, everything else is left undefined.
+#if !defined(CONFIG_DEV_BOARD_DISPLAY) && !defined(CONFIG_FORM_FACTOR_DISPLAY)
+#define CONFIG_DEV_BOARD_DISPLAY 1
+#endif
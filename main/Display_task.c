@@ -2,41 +2,99 @@
 #include "global_defines.h"
 #include "FrameBuffer.h"
 #include "sr_driver.h"
-#include "driver/timer.h"
 
-#include "freertos/semphr.h"
 #include "sdkconfig.h"
 #include <string.h>
+#include <stdatomic.h>
+#include "esp_attr.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #define DISPLAY_TASK_STACK_SIZE 2048
+#define PRINT_SCAN_STATS false
 
-#define TIMER_DIVIDER (16)                                          //  Hardware timer clock divider
-#define TIMER_SCALE (TIMER_BASE_CLK / TIMER_DIVIDER)                // convert counter value to seconds
-#define TIMER_SCALE_US ((TIMER_BASE_CLK / TIMER_DIVIDER) / 1000000) // convert counter value to seconds
+// Each row is scanned as one SPI write per bit plane, binary code modulation:
+// plane p of a depth d frame stays latched for 2^(d - 1 - p) units and the
+// planes take 2^d - 1 units. A write lasts exactly as long as the image written
+// before it is shown, so the image sits at the tail of the write and the
+// padding in front of it sets the time, the SPI peripheral times the scan.
+// Below full brightness the units shrink and a blank write, no row selected,
+// fills the rest of the row period.
+#define ROW_PERIOD_BYTES(hz) (SR_CLOCK_HZ / 8 / ((hz) * FRAME_BUF_ROWS))
+// Writes are whole words so DMA needs no bounce buffer
+#define WRITE_ALIGN(n) (((n) + 3) & ~3)
+#define SLOT_MAX_BYTES WRITE_ALIGN(ROW_PERIOD_BYTES(DISPLAY_MIN_REFRESH_RATE_HZ))
+#define SLOT_MIN_BYTES WRITE_ALIGN(SR_CNT)
+// Writes queued per refill, the other half of the queue keeps the scan going
+#define SCAN_BATCH (SR_QUEUE_DEPTH / 2)
 
-#define DISPLAY_REFRESH_RATE_HZ 90
-#define TIMER_PERIOD_US ((1000000 / DISPLAY_REFRESH_RATE_HZ) / FRAME_BUF_ROWS)
+#if SLOT_MAX_BYTES > SR_MAX_TRANSFER_BYTES || ROW_PERIOD_BYTES(DISPLAY_REFRESH_RATE_HZ) < SR_CNT
+#error "Row period doesn't fit one shift register write, adjust SR_CLOCK_HZ"
+#endif
+#if DISPLAY_IDLE_REFRESH_RATE_HZ < DISPLAY_MIN_REFRESH_RATE_HZ || DISPLAY_IDLE_REFRESH_RATE_HZ > DISPLAY_REFRESH_RATE_HZ
+#error "DISPLAY_IDLE_REFRESH_RATE_HZ out of range"
+#endif
+#if FRAME_BUF_ROWS % SCAN_BATCH != 0
+#error "Frames have to start on a refill, FRAME_BUF_ROWS must be a multiple of SCAN_BATCH"
+#endif
 
 #define DISPLAY_TASK_TAG "DISPLAY_TASK"
 
+// Type Declarations
+// Timing of the latched frame, worked out once per frame
+typedef struct {
+    int depth;
+    int slots_per_row;      // depth, plus one blank write when dimmed
+    int unit_bytes;         // Time the least significant plane is shown
+    int blank_bytes;        // Time the row is off, 0 at full brightness
+} scan_plan_t;
+
 // File Globals
-static uint8_t sr_buffer[SR_CNT] = {0x00};
-static uint8_t row_idx = 0;
+// One write per queue entry, reused once the entry has been collected
+DMA_ATTR static uint8_t slot_writes[SR_QUEUE_DEPTH][SLOT_MAX_BYTES];
+static frame_buffer_t latched_frame;
+static uint32_t shown_sequence = 0;
+static uint32_t next_write = 0;
+static int in_flight = 0;
+static int in_flight_bytes = 0;
+static uint16_t write_lengths[SR_QUEUE_DEPTH];
+static int next_slot = 0;       // Row and plane within the latched frame
+static int shown_bytes = 0;     // How long the last queued image stays latched
+static scan_plan_t plan;
+static int refresh_hz = DISPLAY_REFRESH_RATE_HZ;
+static volatile int scanned_hz = DISPLAY_REFRESH_RATE_HZ;
+static int static_frames = 0;
+static volatile int idle_refresh_hz = DISPLAY_IDLE_REFRESH_RATE_HZ;
+static volatile uint8_t brightness = DISPLAY_MAX_BRIGHTNESS;
+static display_scan_stats_t scan_stats;
 static TaskHandle_t xdisplay_task = NULL;
-static volatile SemaphoreHandle_t xDisplayTimerSem;
+static volatile display_frame_callback_t frame_callback = NULL;
+static atomic_bool parked = false;
+static bool resync = false;     // A write failed to queue, its batch may never notify
 
 // Function Prototypes
 static void display_task(void *pvParameters);
+static void display_wake();
+static void latch_frame();
+static void plan_frame();
+static void start_scan();
+static bool queue_batch();
+static void collect_writes(int count);
+static bool try_park();
 
-static bool IRAM_ATTR timer_group_isr_callback(void *args)
+static void IRAM_ATTR write_done_callback(int id)
 {
+    // The task refills once the last write of a batch went out
+    if (id % SCAN_BATCH != SCAN_BATCH - 1)
+    {
+        return;
+    }
     BaseType_t pxHigherPriorityTaskWoken = pdFALSE;
-    if (xSemaphoreGiveFromISR(xDisplayTimerSem, &pxHigherPriorityTaskWoken) != pdTRUE)
+    vTaskNotifyGiveFromISR(xdisplay_task, &pxHigherPriorityTaskWoken);
+    if (pxHigherPriorityTaskWoken == pdTRUE)
     {
-        return false;
+        portYIELD_FROM_ISR();
     }
-    return pxHigherPriorityTaskWoken == pdTRUE;
 }
 
 // Public Functions
@@ -49,30 +107,11 @@ int init_display_task()
 {
     init_shift_registers();
     buffer_reset(&display_buffer);
+    memset(slot_writes, 0, sizeof(slot_writes));
+    memcpy(&latched_frame, buffer_get_read_buffer(&display_buffer), sizeof(frame_buffer_t));
+    buffer_set_update_hook(&display_buffer, display_wake);
 
-    xDisplayTimerSem = xSemaphoreCreateBinary();
-    if (xDisplayTimerSem == NULL)
-    {
-        ESP_LOGE(DISPLAY_TASK_TAG, "Failed create xDisplayTimerSem");
-        return -1;
-    }
-
-    timer_config_t config = {
-        .divider = TIMER_DIVIDER,
-        .counter_dir = TIMER_COUNT_UP,
-        .counter_en = TIMER_PAUSE,
-        .alarm_en = TIMER_ALARM_EN,
-        .auto_reload = true,
-    }; // default clock source is APB
-
-    timer_init(TIMER_GROUP_0, TIMER_0, &config);
-    timer_set_counter_value(TIMER_GROUP_0, TIMER_0, 0);
-    timer_set_alarm_value(TIMER_GROUP_0, TIMER_0, TIMER_PERIOD_US * TIMER_SCALE_US);
-    timer_enable_intr(TIMER_GROUP_0, TIMER_0);
-
-    timer_isr_callback_add(TIMER_GROUP_0, TIMER_0, timer_group_isr_callback, NULL, 0);
-    timer_start(TIMER_GROUP_0, TIMER_0);
-
+    sr_set_done_callback(write_done_callback);
     xTaskCreate(
         display_task,
         "Display_Task",
@@ -80,6 +119,11 @@ int init_display_task()
         NULL,
         DISPLAY_TASK_PRIORITY,
         &xdisplay_task);
+    if (xdisplay_task == NULL)
+    {
+        ESP_LOGE(DISPLAY_TASK_TAG, "Failed to create display task");
+        return -1;
+    }
     return 0;
 }
 TaskHandle_t display_task_handle()
@@ -87,34 +131,314 @@ TaskHandle_t display_task_handle()
     return xdisplay_task;
 }
 
+/**
+ * @brief Registers a function called from the display task at the start of
+ * every refresh (DISPLAY_REFRESH_RATE_HZ), before the next frame is latched.
+ * A frame it draws and publishes with buffer_update() is shown in that refresh.
+ * Without a callback, scanning stops while the frame is blank.
+ * @param callback Function to call, NULL to remove
+ */
+void set_display_frame_callback(display_frame_callback_t callback)
+{
+    frame_callback = callback;
+    if (callback != NULL)
+    {
+        display_wake();
+    }
+}
+
+/**
+ * @brief Copies the scan totals. Every bit plane adds FRAME_BUF_ROWS writes
+ * per frame, the bytes clocked out stay at SR_CLOCK_HZ / 8 per second while
+ * scanning since the padding times the scan.
+ */
+void get_display_scan_stats(display_scan_stats_t *stats)
+{
+    // Written by the display task only, a torn read is off by one refill at most
+    memcpy(stats, &scan_stats, sizeof(display_scan_stats_t));
+}
+
+/**
+ * @brief Sets how long each row is lit, the rest of its period it's blank.
+ * Takes effect on the next frame. The dimmest level is bounded by the
+ * shortest shift register write, deeper frames bottom out sooner.
+ * @param level 1 to DISPLAY_MAX_BRIGHTNESS (always on)
+ * @return 0 on success, -1 if brightness is 0
+ */
+int set_display_brightness(uint8_t level)
+{
+    if (level == 0)
+    {
+        return -1;
+    }
+    brightness = level;
+    return 0;
+}
+uint8_t get_display_brightness()
+{
+    return brightness;
+}
+
+/**
+ * @brief Sets the refresh rate used while the frame stays the same, fewer
+ * rows per second means fewer SPI interrupts and display task wakeups.
+ * DISPLAY_REFRESH_RATE_HZ turns the drop off.
+ * @return 0 on success, -1 if out of DISPLAY_MIN_REFRESH_RATE_HZ to
+ * DISPLAY_REFRESH_RATE_HZ
+ */
+int set_display_idle_refresh_rate(int refresh)
+{
+    if (refresh < DISPLAY_MIN_REFRESH_RATE_HZ || refresh > DISPLAY_REFRESH_RATE_HZ)
+    {
+        return -1;
+    }
+    idle_refresh_hz = refresh;
+    return 0;
+}
+int get_display_idle_refresh_rate()
+{
+    return idle_refresh_hz;
+}
+/**
+ * @brief Refresh rate of the frame being scanned, rounded to Hz. Bit plane
+ * timing is rounded to whole words, so deeper frames can come out faster
+ * than the requested rate.
+ */
+int get_display_refresh_rate()
+{
+    return scanned_hz;
+}
+
 // Private Functions
-static inline void update_display()
+static void display_wake()
+{
+    // Any context but an ISR, the display task itself never sees parked set.
+    // The caller stored the new sequence or callback, try_park() stores
+    // parked, and each side fences before loading the other's value, so at
+    // least one of them sees the other's store and no wake gets lost.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load(&parked))
+    {
+        xTaskNotifyGive(xdisplay_task);
+    }
+}
+
+static void latch_frame()
+{
+    // Rows of one refresh all come from the same frame, even if the read
+    // buffer is swapped while the end of it is still queued
+    display_frame_callback_t callback = frame_callback;
+    if (callback != NULL)
+    {
+        callback();
+    }
+    // Copy every frame the queue moves on to, at depth 4 a burst is shown
+    // one frame per refresh after the newest sequence was already seen
+    if (buffer_start_of_frame(&display_buffer))
+    {
+        memcpy(&latched_frame, buffer_get_read_buffer(&display_buffer), sizeof(frame_buffer_t));
+    }
+    // shown_sequence is the latched frame's, so parking and the idle rate
+    // wait for the frames still queued behind it
+    uint32_t sequence = buffer_get_read_sequence(&display_buffer);
+    if (sequence != shown_sequence || buffer_get_sequence(&display_buffer) != sequence)
+    {
+        shown_sequence = sequence;
+        static_frames = 0;
+    }
+    else if (static_frames < DISPLAY_IDLE_FRAMES)
+    {
+        static_frames++;
+    }
+    // Back to the full rate on the first new frame
+    refresh_hz = (static_frames < DISPLAY_IDLE_FRAMES) ? DISPLAY_REFRESH_RATE_HZ : idle_refresh_hz;
+    plan_frame();
+
+    scan_stats.frames++;
+    scan_stats.photon_lead_us = (uint32_t)((uint64_t)in_flight_bytes * 8 * 1000000 / SR_CLOCK_HZ);
+    if (PRINT_SCAN_STATS && scan_stats.frames % (DISPLAY_REFRESH_RATE_HZ * 10) == 0)
+    {
+        ESP_LOGI(DISPLAY_TASK_TAG, "Frames: %u, Writes: %u, Bytes: %llu, Wakeups: %u, Busy: %lluus, Errors: %u",
+                 scan_stats.frames, scan_stats.writes, scan_stats.bytes, scan_stats.wakeups, scan_stats.busy_us,
+                 scan_stats.write_errors);
+    }
+}
+
+static void plan_frame()
 {
-    // sr_buffer[0] corresponds to ROW select shift register,
-    // while sr_buffer[1:N] corresponds to column data
+    // Nearest word multiple to an even split of the lit part of the row period
+    int row_bytes = ROW_PERIOD_BYTES(refresh_hz);
+    int lit_bytes = row_bytes * brightness / DISPLAY_MAX_BRIGHTNESS;
+    int units = (1 << latched_frame.depth) - 1;
+    int unit = (((lit_bytes + units / 2) / units) + 2) & ~3;
+    if (unit < SLOT_MIN_BYTES)
+    {
+        unit = SLOT_MIN_BYTES;
+    }
 
-    if (row_idx == 0)
+    plan.depth = latched_frame.depth;
+    plan.unit_bytes = unit;
+    plan.blank_bytes = (row_bytes - unit * units) & ~3;
+    if (plan.blank_bytes < SLOT_MIN_BYTES || brightness == DISPLAY_MAX_BRIGHTNESS)
     {
-        buffer_start_of_frame(&display_buffer);
+        plan.blank_bytes = 0;
     }
-    sr_buffer[0] = (1 << row_idx);
-    frame_buffer_t *rbuf = buffer_get_read_buffer(&display_buffer);
-    memcpy(&sr_buffer[1], rbuf->frame_buffer[row_idx], FRAME_BUF_COL_BYTES);
+    plan.slots_per_row = plan.depth + ((plan.blank_bytes > 0) ? 1 : 0);
+
+    int frame_bytes = (unit * units + plan.blank_bytes) * FRAME_BUF_ROWS;
+    scanned_hz = (SR_CLOCK_HZ / 8 + frame_bytes / 2) / frame_bytes;
+}
 
-    sr_write(sr_buffer, SR_CNT);
-    row_idx = (row_idx + 1) % FRAME_BUF_ROWS;
+static void start_scan()
+{
+    // Nothing is latched yet, the first write only needs to carry its image
+    next_slot = 0;
+    shown_bytes = SLOT_MIN_BYTES;
+    if (queue_batch())
+    {
+        queue_batch();
+    }
 }
+
+static bool queue_batch()
+{
+    // Frames start on a batch, so a blank one parks with nothing half queued
+    if (next_slot == 0)
+    {
+        latch_frame();
+        if (try_park())
+        {
+            return false;
+        }
+    }
+
+    for (int i = 0; i < SCAN_BATCH; i++)
+    {
+        int row = next_slot / plan.slots_per_row;
+        int plane = next_slot % plan.slots_per_row;
+        int len = shown_bytes;
+        uint8_t *write = &slot_writes[next_write % SR_QUEUE_DEPTH][SLOT_MAX_BYTES - len];
+
+        // Row select shift register first, then the column data. The blank
+        // write after the planes selects no row, its columns don't matter.
+        if (plane < plan.depth)
+        {
+            write[len - SR_CNT] = (1 << row);
+            memcpy(&write[len - SR_CNT + 1], frame_plane_row(&latched_frame, plane, row), FRAME_BUF_COL_BYTES);
+            shown_bytes = plan.unit_bytes << (plan.depth - 1 - plane);
+        }
+        else
+        {
+            write[len - SR_CNT] = 0x00;
+            shown_bytes = plan.blank_bytes;
+        }
+        // No logging here, it would throw off the row timing
+        if (sr_queue_write(write, len, next_write % SR_QUEUE_DEPTH) < 0)
+        {
+            scan_stats.write_errors++;
+            resync = true;
+        }
+        else
+        {
+            in_flight++;
+            in_flight_bytes += len;
+            write_lengths[next_write % SR_QUEUE_DEPTH] = len;
+            scan_stats.writes++;
+            scan_stats.bytes += len;
+        }
+        next_write++;
+
+        if (shown_bytes > SLOT_MAX_BYTES)
+        {
+            shown_bytes = SLOT_MAX_BYTES;
+        }
+        next_slot = (next_slot + 1) % (FRAME_BUF_ROWS * plan.slots_per_row);
+    }
+    if (resync)
+    {
+        // The failed write may have been the one to notify, wake up anyway
+        xTaskNotifyGive(xdisplay_task);
+    }
+    return true;
+}
+
+static void collect_writes(int count)
+{
+    int id;
+    for (int i = 0; i < count && in_flight > 0; i++)
+    {
+        if (sr_collect_write(&id) == 0)
+        {
+            in_flight_bytes -= write_lengths[id];
+        }
+        in_flight--;
+    }
+}
+
+static bool try_park()
+{
+    // A blank frame needs no scanning. Set parked before checking again so
+    // a frame published in between wakes the task right back up, and stay
+    // awake while frames newer than the latched one are still queued.
+    if (frame_callback != NULL || !buffer_frame_is_clear(&latched_frame))
+    {
+        return false;
+    }
+
+    // Let the end of the last frame finish, it's blank as well
+    collect_writes(in_flight);
+    sr_clear();
+    ulTaskNotifyTake(pdTRUE, 0);
+    resync = false;
+    atomic_store(&parked, true);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (frame_callback != NULL || buffer_get_sequence(&display_buffer) != shown_sequence)
+    {
+        atomic_store(&parked, false);
+        return false;
+    }
+    return true;
+}
+
 static void display_task(void *pvParameters)
 {
     ESP_LOGI(DISPLAY_TASK_TAG, "Display task started");
+
+    // Two batches in flight, then refill one each time one has gone out
+    start_scan();
     while (1)
     {
-        if (xSemaphoreTake(xDisplayTimerSem, portMAX_DELAY) == pdFALSE)
+        // One notification per finished batch, don't drop any
+        ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+        int64_t start_time = esp_timer_get_time();
+        scan_stats.wakeups++;
+        if (atomic_load(&parked))
+        {
+            // Woken by a new frame or frame callback, resume scanning from
+            // row 0. Several wakes may have been counted while parked.
+            atomic_store(&parked, false);
+            ulTaskNotifyTake(pdTRUE, 0);
+            start_scan();
+        }
+        else if (resync)
         {
-            ESP_LOGE(DISPLAY_TASK_TAG, "Failed to take semaphore");
-            vTaskDelay(1);
-            continue;
+            // Let whatever did get queued finish, then start over from row 0
+            // of the next frame. Every done notification has fired by then.
+            collect_writes(in_flight);
+            ulTaskNotifyTake(pdTRUE, 0);
+            resync = false;
+            ESP_LOGW(DISPLAY_TASK_TAG, "SPI write failed, restarting scan (%u errors)", scan_stats.write_errors);
+            start_scan();
         }
-        update_display();
+        else
+        {
+            collect_writes(SCAN_BATCH);
+            // A frame that nearly parked let the queue run dry, fill it back up
+            if (queue_batch() && in_flight <= SCAN_BATCH)
+            {
+                queue_batch();
+            }
+        }
+        scan_stats.busy_us += (uint64_t)(esp_timer_get_time() - start_time);
     }
-}
\ No newline at end of file
+}
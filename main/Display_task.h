@@ -3,5 +3,33 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
+#define DISPLAY_REFRESH_RATE_HZ 90
+// Slowest refresh, a row period has to fit one shift register write
+#define DISPLAY_MIN_REFRESH_RATE_HZ 60
+// Refresh once the frame hasn't changed for DISPLAY_IDLE_FRAMES refreshes
+#define DISPLAY_IDLE_REFRESH_RATE_HZ 60
+#define DISPLAY_IDLE_FRAMES DISPLAY_REFRESH_RATE_HZ
+#define DISPLAY_MAX_BRIGHTNESS 255
+
+typedef void (*display_frame_callback_t)(void);
+
+// Running totals of the scan since boot
+typedef struct {
+    uint32_t frames;    // Frames scanned
+    uint32_t writes;    // SPI writes, one per row and bit plane
+    uint64_t bytes;     // Bytes clocked out, padding included
+    uint32_t wakeups;   // Display task wakeups to refill the SPI queue
+    uint64_t busy_us;   // Time the display task spent refilling
+    uint32_t photon_lead_us; // Scan still queued when the last frame was latched, its first row lights after that
+    uint32_t write_errors;   // Writes that couldn't be queued, the scan restarts on the next frame after one
+} display_scan_stats_t;
+
 int init_display_task();
-TaskHandle_t display_task_handle();
\ No newline at end of file
+TaskHandle_t display_task_handle();
+void set_display_frame_callback(display_frame_callback_t callback);
+void get_display_scan_stats(display_scan_stats_t *stats);
+int set_display_brightness(uint8_t brightness);
+uint8_t get_display_brightness();
+int set_display_idle_refresh_rate(int refresh_hz);
+int get_display_idle_refresh_rate();
+int get_display_refresh_rate();
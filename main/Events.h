@@ -24,6 +24,7 @@ typedef enum
     WIFI_READY,
     WIFI_CONNECTED,
     WIFI_DISCONNECTED,
+    BEAT_DETECTED, // Onset in the music, tempo from get_fft_beat_bpm(). Only pushed while a callback is registered.
     NUM_EVENTS,
 } em_system_event_t;
 
@@ -42,52 +42,105 @@
 
 #define FFT_OWN_INPUT_MEM 1
 #define FFT_OWN_OUTPUT_MEM 2
+#define FFT_OWN_TWIDDLE_MEM 4
 
 #define TWO_PI 6.28318530
 #define USE_SPLIT_RADIX 1
 #define LARGE_BASE_CASE 1
 
-static void fft(float *input, float *output, float *twiddle_factors, int n);
-static void ifft(float *input, float *output, float *twiddle_factors, int n);
-static void rfft(float *x, float *y, float *twiddle_factors, int n);
-static void irfft(float *x, float *y, float *twiddle_factors, int n);
-static void fft_primitive(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride);
-static void split_radix_fft(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride);
-static void ifft_primitive(float *input, float *output, int n, int stride, float *twiddle_factors, int tw_stride);
+static void fft(float *input, float *output, const float *twiddle_factors, int n);
+static void ifft(float *input, float *output, const float *twiddle_factors, int n);
+static void rfft(float *x, float *y, const float *twiddle_factors, int n);
+static void irfft(float *x, float *y, const float *twiddle_factors, int n);
+static void fft_primitive(float *x, float *y, int n, int stride, const float *twiddle_factors, int tw_stride);
+static void split_radix_fft(float *x, float *y, int n, int stride, const float *twiddle_factors, int tw_stride);
+static void ifft_primitive(float *input, float *output, int n, int stride, const float *twiddle_factors, int tw_stride);
 static inline void fft8(float *input, int stride_in, float *output, int stride_out);
 static inline void fft4(float *input, int stride_in, float *output, int stride_out);
+static void rfft_postprocess(float *y, const float *twiddle_factors, int n);
+static void irfft_preprocess(float *x, const float *twiddle_factors, int n);
+static int radix4_twiddle_count(int n);
+static void radix4_init_twiddles(float *twiddle_factors, int n);
+static void radix4_fft(float *x, float *y, const float *twiddle_factors, int n, int inverse);
+static void radix4_rfft(float *x, float *y, const float *twiddle_factors, int n);
+static void radix4_irfft(float *x, float *y, const float *twiddle_factors, int n);
 
 fft_config_t *fft_init(int size, fft_type_t type, fft_direction_t direction, float *input, float *output)
+{
+    return fft_init_engine(size, type, direction, FFT_ENGINE_SPLIT_RADIX, input, output);
+}
+
+fft_config_t *fft_init_engine(int size, fft_type_t type, fft_direction_t direction, fft_engine_t engine, float *input, float *output)
 {
     /*
      * Prepare an FFT of correct size and types.
      *
      * If no input or output buffers are provided, they will be allocated.
+     * For sizes covered by FFT_tables.c, prefer the static plans in FFT.h,
+     * they don't use the heap at all.
      */
     int k, m;
-
-    fft_config_t *config = (fft_config_t *)malloc(sizeof(fft_config_t));
+    float *twiddle_factors;
 
     // Check if the size is a power of two
-    if ((size & (size - 1)) != 0) // tests if size is a power of two
+    if (size < 2 || (size & (size - 1)) != 0) // tests if size is a power of two
+        return NULL;
+
+    int complex_size = (type == FFT_REAL) ? size / 2 : size;
+    if (engine == FFT_ENGINE_RADIX4 && complex_size < 2)
+        return NULL;
+
+    fft_config_t *config = (fft_config_t *)calloc(1, sizeof(fft_config_t));
+    if (config == NULL)
         return NULL;
 
     // start configuration
-    config->flags = 0;
+    config->flags = FFT_OWN_TWIDDLE_MEM;
     config->type = type;
     config->direction = direction;
+    config->engine = engine;
     config->size = size;
 
     // Allocate and precompute twiddle factors
-    config->twiddle_factors = (float *)malloc(2 * config->size * sizeof(float));
-
-    float two_pi_by_n = TWO_PI / config->size;
-
-    for (k = 0, m = 0; k < config->size; k++, m += 2)
+    if (config->engine == FFT_ENGINE_RADIX4)
+    {
+        // Real plans keep the first half of the split-radix table for the
+        // real/complex post-processing, followed by the stage twiddles
+        int real_count = (config->type == FFT_REAL) ? config->size / 2 : 0;
+        twiddle_factors = (float *)malloc((real_count + radix4_twiddle_count(complex_size)) * sizeof(float));
+        if (twiddle_factors == NULL)
+        {
+            fft_destroy(config);
+            return NULL;
+        }
+
+        // Same values as Scripts/gen_fft_tables.py
+        for (k = 0, m = 0; m < real_count; k++, m += 2)
+        {
+            double a = 2.0 * M_PI * k / config->size;
+            twiddle_factors[m] = (float)cos(a);
+            twiddle_factors[m + 1] = (float)sin(a);
+        }
+        radix4_init_twiddles(twiddle_factors + real_count, complex_size);
+    }
+    else
     {
-        config->twiddle_factors[m] = cosf(two_pi_by_n * k);     // real
-        config->twiddle_factors[m + 1] = sinf(two_pi_by_n * k); // imag
+        twiddle_factors = (float *)malloc(2 * config->size * sizeof(float));
+        if (twiddle_factors == NULL)
+        {
+            fft_destroy(config);
+            return NULL;
+        }
+
+        float two_pi_by_n = TWO_PI / config->size;
+
+        for (k = 0, m = 0; k < config->size; k++, m += 2)
+        {
+            twiddle_factors[m] = cosf(two_pi_by_n * k);     // real
+            twiddle_factors[m + 1] = sinf(two_pi_by_n * k); // imag
+        }
     }
+    config->twiddle_factors = twiddle_factors;
 
     // Allocate input buffer
     if (input != NULL)
@@ -103,7 +156,10 @@ fft_config_t *fft_init(int size, fft_type_t type, fft_direction_t direction, flo
     }
 
     if (config->input == NULL)
+    {
+        fft_destroy(config);
         return NULL;
+    }
 
     // Allocate output buffer
     if (output != NULL)
@@ -119,25 +175,48 @@ fft_config_t *fft_init(int size, fft_type_t type, fft_direction_t direction, flo
     }
 
     if (config->output == NULL)
+    {
+        fft_destroy(config);
         return NULL;
+    }
 
     return config;
 }
 
 void fft_destroy(fft_config_t *config)
 {
+    /*
+     * Only for plans created by fft_init(), static plans own nothing
+     */
+    if (config == NULL)
+        return;
+
     if (config->flags & FFT_OWN_INPUT_MEM)
         free(config->input);
 
     if (config->flags & FFT_OWN_OUTPUT_MEM)
         free(config->output);
 
-    free(config->twiddle_factors);
+    if (config->flags & FFT_OWN_TWIDDLE_MEM)
+        free((void *)config->twiddle_factors);
     free(config);
 }
 
 void fft_execute(fft_config_t *config)
 {
+    if (config->engine == FFT_ENGINE_RADIX4)
+    {
+        if (config->type == FFT_REAL && config->direction == FFT_FORWARD)
+            radix4_rfft(config->input, config->output, config->twiddle_factors, config->size);
+        else if (config->type == FFT_REAL && config->direction == FFT_BACKWARD)
+            radix4_irfft(config->input, config->output, config->twiddle_factors, config->size);
+        else if (config->type == FFT_COMPLEX && config->direction == FFT_FORWARD)
+            radix4_fft(config->input, config->output, config->twiddle_factors, config->size, 0);
+        else if (config->type == FFT_COMPLEX && config->direction == FFT_BACKWARD)
+            radix4_fft(config->input, config->output, config->twiddle_factors, config->size, 1);
+        return;
+    }
+
     if (config->type == FFT_REAL && config->direction == FFT_FORWARD)
         rfft(config->input, config->output, config->twiddle_factors, config->size);
     else if (config->type == FFT_REAL && config->direction == FFT_BACKWARD)
@@ -148,7 +227,7 @@ void fft_execute(fft_config_t *config)
         ifft(config->input, config->output, config->twiddle_factors, config->size);
 }
 
-static void fft(float *input, float *output, float *twiddle_factors, int n)
+static void fft(float *input, float *output, const float *twiddle_factors, int n)
 {
     /*
      * Forward fast Fourier transform
@@ -173,7 +252,7 @@ static void fft(float *input, float *output, float *twiddle_factors, int n)
 #endif
 }
 
-static void ifft(float *input, float *output, float *twiddle_factors, int n)
+static void ifft(float *input, float *output, const float *twiddle_factors, int n)
 {
     /*
      * Inverse fast Fourier transform
@@ -193,7 +272,7 @@ static void ifft(float *input, float *output, float *twiddle_factors, int n)
     ifft_primitive(input, output, n, 2, twiddle_factors, 2);
 }
 
-static void rfft(float *x, float *y, float *twiddle_factors, int n)
+static void rfft(float *x, float *y, const float *twiddle_factors, int n)
 {
 
     // This code uses the two-for-the-price-of-one strategy
@@ -203,6 +282,17 @@ static void rfft(float *x, float *y, float *twiddle_factors, int n)
     fft_primitive(x, y, n / 2, 2, twiddle_factors, 4);
 #endif
 
+    rfft_postprocess(y, twiddle_factors, n);
+}
+
+static void rfft_postprocess(float *y, const float *twiddle_factors, int n)
+{
+    /*
+     * Recovers the positive frequencies of a real FFT of size n from the
+     * complex FFT of size n / 2 of its even/odd samples. Only uses the
+     * first n / 2 entries of the twiddle table.
+     */
+
     // Now apply post processing to recover positive
     // frequencies of the real FFT
     float t = y[0];
@@ -241,11 +331,20 @@ static void rfft(float *x, float *y, float *twiddle_factors, int n)
     }
 }
 
-static void irfft(float *x, float *y, float *twiddle_factors, int n)
+static void irfft(float *x, float *y, const float *twiddle_factors, int n)
 {
     /*
      * Destroys content of input vector
      */
+    irfft_preprocess(x, twiddle_factors, n);
+    ifft_primitive(x, y, n / 2, 2, twiddle_factors, 4);
+}
+
+static void irfft_preprocess(float *x, const float *twiddle_factors, int n)
+{
+    /*
+     * Inverse of rfft_postprocess, done in place on the packed spectrum
+     */
     int k;
 
     // Here we need to apply a pre-processing first
@@ -277,11 +376,9 @@ static void irfft(float *x, float *y, float *twiddle_factors, int n)
         x[n - k] = xer + xoi;
         x[n - k + 1] = x0r - xei;
     }
-
-    ifft_primitive(x, y, n / 2, 2, twiddle_factors, 4);
 }
 
-static void fft_primitive(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride)
+static void fft_primitive(float *x, float *y, int n, int stride, const float *twiddle_factors, int tw_stride)
 {
     /*
      * This code will compute the FFT of the input vector x
@@ -369,7 +466,7 @@ static void fft_primitive(float *x, float *y, int n, int stride, float *twiddle_
     }
 }
 
-static void split_radix_fft(float *x, float *y, int n, int stride, float *twiddle_factors, int tw_stride)
+static void split_radix_fft(float *x, float *y, int n, int stride, const float *twiddle_factors, int tw_stride)
 {
     /*
      * This code will compute the FFT of the input vector x
@@ -508,7 +605,7 @@ static void split_radix_fft(float *x, float *y, int n, int stride, float *twiddl
     }
 }
 
-static void ifft_primitive(float *input, float *output, int n, int stride, float *twiddle_factors, int tw_stride)
+static void ifft_primitive(float *input, float *output, int n, int stride, const float *twiddle_factors, int tw_stride)
 {
 
 #if USE_SPLIT_RADIX
@@ -698,3 +795,235 @@ static inline void fft4(float *input, int stride_in, float *output, int stride_o
     output[stride_out + 1] = t1 + t2;
     output[3 * stride_out + 1] = t1 - t2;
 }
+
+/*
+ * Iterative radix-4 engine
+ * ========================
+ *
+ * The first stage reads the input in bit-reversed order into the output
+ * buffer, the remaining DIT stages then work in place on the output. When log2(n) is odd the first stage is
+ * radix-2, every other stage is radix-4. Bit-reversed order places the four
+ * sub-transforms of a radix-4 butterfly as (x[4j], x[4j+2], x[4j+1], x[4j+3]),
+ * hence the swapped middle blocks below.
+ *
+ * The stage twiddles are stored in the order the butterflies read them:
+ * for each stage of span 4L (L > 1), for k = 0..L-1,
+ * [cos(a), sin(a), cos(2a), sin(2a), cos(3a), sin(3a)] with a = 2 pi k / 4L.
+ * The inner loops only walk forward through contiguous memory and are
+ * written as multiply-add chains so the compiler can use the FPU's fused
+ * MADD on the ESP32 and vectorize on the host.
+ */
+
+static inline int radix4_first_span(int n)
+{
+    // log2(n) odd -> a radix-2 stage first, sub-transforms of size 2
+    int log2n = 0;
+    while ((1 << log2n) < n)
+        log2n++;
+    return (log2n & 1) ? 2 : 1;
+}
+
+static int radix4_twiddle_count(int n)
+{
+    int count = 0;
+    for (int L = radix4_first_span(n); 4 * L <= n; L *= 4)
+    {
+        if (L > 1)
+            count += 6 * L;
+    }
+    return count;
+}
+
+static void radix4_init_twiddles(float *twiddle_factors, int n)
+{
+    for (int L = radix4_first_span(n); 4 * L <= n; L *= 4)
+    {
+        if (L == 1)
+            continue;
+
+        double two_pi_by_span = 2.0 * M_PI / (4 * L);
+        for (int k = 0; k < L; k++)
+        {
+            double a = two_pi_by_span * k;
+            *twiddle_factors++ = (float)cos(a);
+            *twiddle_factors++ = (float)sin(a);
+            *twiddle_factors++ = (float)cos(2 * a);
+            *twiddle_factors++ = (float)sin(2 * a);
+            *twiddle_factors++ = (float)cos(3 * a);
+            *twiddle_factors++ = (float)sin(3 * a);
+        }
+    }
+}
+
+static inline int radix4_next_reversed(int j, int n)
+{
+    // Increments j in bit-reversed order for indices below n
+    int bit = n >> 1;
+    while (j & bit)
+    {
+        j ^= bit;
+        bit >>= 1;
+    }
+    return j | bit;
+}
+
+static inline void radix2_first_stage(const float *restrict x, float *restrict y, int n, int re, int im)
+{
+    /*
+     * Reads x in bit-reversed order, y[2g], y[2g+1] take x[rev(g)] and
+     * x[rev(g) + n / 2] where rev() reverses over n / 2 indices
+     */
+    const float *restrict x1 = x + n;
+    for (int g = 0, j = 0; g < n / 2; g++)
+    {
+        float ar = x[2 * j + re];
+        float ai = x[2 * j + im];
+        float br = x1[2 * j + re];
+        float bi = x1[2 * j + im];
+        y[4 * g] = ar + br;
+        y[4 * g + 1] = ai + bi;
+        y[4 * g + 2] = ar - br;
+        y[4 * g + 3] = ai - bi;
+        j = radix4_next_reversed(j, n / 2);
+    }
+}
+
+static inline void radix4_first_stage(const float *restrict x, float *restrict y, int n, int re, int im)
+{
+    /*
+     * Span 4, all twiddles are 1. Group g takes x[rev(g) + q n / 4] for
+     * q = 0..3 where rev() reverses over n / 4 indices.
+     */
+    const float *restrict x1 = x + n / 2;
+    const float *restrict x2 = x + n;
+    const float *restrict x3 = x + 3 * n / 2;
+    for (int g = 0, j = 0; g < n / 4; g++)
+    {
+        float ar = x[2 * j + re];
+        float ai = x[2 * j + im];
+        float br = x1[2 * j + re];
+        float bi = x1[2 * j + im];
+        float cr = x2[2 * j + re];
+        float ci = x2[2 * j + im];
+        float dr = x3[2 * j + re];
+        float di = x3[2 * j + im];
+
+        float t0r = ar + cr;
+        float t0i = ai + ci;
+        float t1r = ar - cr;
+        float t1i = ai - ci;
+        float t2r = br + dr;
+        float t2i = bi + di;
+        float t3r = br - dr;
+        float t3i = bi - di;
+
+        float *restrict out = y + 8 * g;
+        out[0] = t0r + t2r;
+        out[1] = t0i + t2i;
+        out[2] = t1r + t3i;
+        out[3] = t1i - t3r;
+        out[4] = t0r - t2r;
+        out[5] = t0i - t2i;
+        out[6] = t1r - t3i;
+        out[7] = t1i + t3r;
+        j = radix4_next_reversed(j, n / 4);
+    }
+}
+
+static inline void radix4_stage(float *restrict y, int n, int L, const float *restrict twiddle_factors)
+{
+    for (int g = 0; g < n; g += 4 * L)
+    {
+        float *restrict p0 = y + 2 * g;    // x[4j]
+        float *restrict p1 = p0 + 2 * L;   // x[4j + 2]
+        float *restrict p2 = p1 + 2 * L;   // x[4j + 1]
+        float *restrict p3 = p2 + 2 * L;   // x[4j + 3]
+        const float *restrict w = twiddle_factors;
+
+        for (int k = 0; k < 2 * L; k += 2, w += 6)
+        {
+            float ar = p0[k];
+            float ai = p0[k + 1];
+
+            // Multiply by the conjugate twiddles, W^k = cos(a) - j sin(a)
+            float br = w[0] * p2[k] + w[1] * p2[k + 1];
+            float bi = w[0] * p2[k + 1] - w[1] * p2[k];
+            float cr = w[2] * p1[k] + w[3] * p1[k + 1];
+            float ci = w[2] * p1[k + 1] - w[3] * p1[k];
+            float dr = w[4] * p3[k] + w[5] * p3[k + 1];
+            float di = w[4] * p3[k + 1] - w[5] * p3[k];
+
+            float t0r = ar + cr;
+            float t0i = ai + ci;
+            float t1r = ar - cr;
+            float t1i = ai - ci;
+            float t2r = br + dr;
+            float t2i = bi + di;
+            float t3r = br - dr;
+            float t3i = bi - di;
+
+            p0[k] = t0r + t2r;
+            p0[k + 1] = t0i + t2i;
+            p1[k] = t1r + t3i;
+            p1[k + 1] = t1i - t3r;
+            p2[k] = t0r - t2r;
+            p2[k + 1] = t0i - t2i;
+            p3[k] = t1r - t3i;
+            p3[k + 1] = t1i + t3r;
+        }
+    }
+}
+
+static void radix4_fft(float *x, float *y, const float *twiddle_factors, int n, int inverse)
+{
+    /*
+     * Complex FFT of size n, out-of-place, input is preserved. The inverse
+     * transform is computed as swap(fft(swap(x))) / n.
+     */
+    // Exchanging real and imaginary parts on load turns the forward
+    // transform into an unscaled inverse one
+    int re = inverse ? 1 : 0;
+    int im = inverse ? 0 : 1;
+
+    // The first stage reads the input in bit-reversed order
+    int L = radix4_first_span(n);
+    if (L == 2)
+        radix2_first_stage(x, y, n, re, im);
+    else
+    {
+        radix4_first_stage(x, y, n, re, im);
+        L = 4;
+    }
+
+    for (; 4 * L <= n; L *= 4)
+    {
+        radix4_stage(y, n, L, twiddle_factors);
+        twiddle_factors += 6 * L;
+    }
+
+    if (inverse)
+    {
+        float norm = 1.0f / n;
+        for (int i = 0; i < 2 * n; i += 2)
+        {
+            float t = y[i];
+            y[i] = y[i + 1] * norm;
+            y[i + 1] = t * norm;
+        }
+    }
+}
+
+static void radix4_rfft(float *x, float *y, const float *twiddle_factors, int n)
+{
+    radix4_fft(x, y, twiddle_factors + n / 2, n / 2, 0);
+    rfft_postprocess(y, twiddle_factors, n);
+}
+
+static void radix4_irfft(float *x, float *y, const float *twiddle_factors, int n)
+{
+    /*
+     * Destroys content of input vector
+     */
+    irfft_preprocess(x, twiddle_factors, n);
+    radix4_fft(x, y, twiddle_factors + n / 2, n / 2, 1);
+}
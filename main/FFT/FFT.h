@@ -35,6 +35,7 @@
 
 */
 #pragma once
+#include "FFT_tables.h"
 
 /*
 #include <stdlib.h>
@@ -55,21 +56,53 @@ typedef enum
   FFT_BACKWARD
 } fft_direction_t;
 
+typedef enum
+{
+  FFT_ENGINE_SPLIT_RADIX, // recursive split-radix, general purpose
+  FFT_ENGINE_RADIX4       // iterative radix-4 (with one radix-2 stage for odd powers of two)
+} fft_engine_t;
+
 typedef struct
 {
   int size;                  // FFT size
   float *input;              // pointer to input buffer
   float *output;             // pointer to output buffer
-  float *twiddle_factors;    // pointer to buffer holding twiddle factors
+  const float *twiddle_factors; // pointer to buffer holding twiddle factors
   fft_type_t type;           // real or complex
   fft_direction_t direction; // forward or backward
+  fft_engine_t engine;       // transform implementation, determines the twiddle layout
   unsigned int flags;        // FFT flags
 } fft_config_t;
 
 fft_config_t *fft_init(int size, fft_type_t type, fft_direction_t direction, float *input, float *output);
+fft_config_t *fft_init_engine(int size, fft_type_t type, fft_direction_t direction, fft_engine_t engine, float *input, float *output);
 void fft_destroy(fft_config_t *config);
 void fft_execute(fft_config_t *config);
 
+/*
+ * Static plans
+ *
+ * Plans for real transforms with the radix-4 engine that reference const
+ * twiddle tables generated by Scripts/gen_fft_tables.py, so they live in
+ * flash and need no heap. N must be one of the generated sizes (see
+ * FFT_tables.h). Don't call fft_destroy() on them.
+ *
+ *   static fft_config_t plan = FFT_RADIX4_REAL_STATIC_PLAN(2048, FFT_FORWARD, input, output);
+ */
+#define FFT_CONCAT_(a, b) a##b
+#define FFT_CONCAT(a, b) FFT_CONCAT_(a, b)
+#define FFT_RADIX4_REAL_STATIC_PLAN(N, dir, in, out) \
+  {                                                    \
+    .size = (N),                                       \
+    .input = (in),                                     \
+    .output = (out),                                   \
+    .twiddle_factors = FFT_CONCAT(fft_radix4_real_twiddles_, N), \
+    .type = FFT_REAL,                                  \
+    .direction = (dir),                                \
+    .engine = FFT_ENGINE_RADIX4,                       \
+    .flags = 0,                                        \
+  }
+
 /*
 void fft(float *input, float *output, float *twiddle_factors, int n);
 void ifft(float *input, float *output, float *twiddle_factors, int n);
@@ -0,0 +1,84 @@
+#include "FFT_agc.h"
+
+#include <stddef.h>
+
+// Fastest rise in doublings per second, when every bucket is above the level
+#define FFT_AGC_RISE_PER_S 4
+
+// Function Prototypes
+static uint32_t exp2_q16(int32_t v);
+
+// Public Functions
+
+/**
+ * @brief Initializes the AGC at its lowest level, call fft_agc_set_rate()
+ * before the first update
+ * @param agc AGC to initialize
+ * @param percentile Percentile of the bucket magnitudes to track, 1 to 99
+ * @param min_level Lowest magnitude the level may drop to, keeps silence dark
+ * @param max_level Highest magnitude the level may rise to
+ */
+void fft_agc_init(fft_agc_t *agc, uint32_t percentile, uint32_t min_level, uint32_t max_level)
+{
+    agc->percentile = (percentile < 1) ? 1 : (percentile > 99) ? 99 : percentile;
+    agc->min_q16 = (int32_t)fft_log2_q8((min_level > 0) ? min_level : 1) << 8;
+    agc->max_q16 = (int32_t)fft_log2_q8((max_level > min_level) ? max_level : min_level + 1) << 8;
+    agc->level_q16 = agc->min_q16;
+    agc->up_q16 = 0;
+    agc->down_q16 = 0;
+}
+
+/**
+ * @brief Sets the per observation steps, must be called again whenever the
+ * frame rate or bucket count change
+ */
+void fft_agc_set_rate(fft_agc_t *agc, float frames_per_s, int num_buckets)
+{
+    if (frames_per_s <= 0 || num_buckets <= 0)
+    {
+        return;
+    }
+    float up = (float)FFT_AGC_RISE_PER_S * FFT_AGC_ONE_DOUBLING / (frames_per_s * num_buckets);
+    float down = up * (100 - agc->percentile) / agc->percentile;
+    agc->up_q16 = (up < 1.0f) ? 1 : (int32_t)up;
+    agc->down_q16 = (down < 1.0f) ? 1 : (int32_t)down;
+}
+
+/**
+ * @brief Moves the level by one frame of bucket magnitudes, O(num_buckets)
+ */
+void fft_agc_update(fft_agc_t *agc, const uint32_t mags[], int num_buckets)
+{
+    // Compare magnitudes against the level instead of taking num_buckets logs
+    uint32_t threshold = exp2_q16(agc->level_q16);
+    int above = 0;
+    for (int i = 0; i < num_buckets; i++)
+    {
+        above += (mags[i] > threshold);
+    }
+
+    int32_t level = agc->level_q16 + above * agc->up_q16 - (num_buckets - above) * agc->down_q16;
+    agc->level_q16 = (level < agc->min_q16) ? agc->min_q16 : (level > agc->max_q16) ? agc->max_q16 : level;
+}
+
+/**
+ * @brief Magnitude at the tracked percentile
+ */
+uint32_t fft_agc_reference(const fft_agc_t *agc)
+{
+    return exp2_q16(agc->level_q16);
+}
+
+// Private Functions
+static uint32_t exp2_q16(int32_t v)
+{
+    // Inverse of fft_log2_q8(): linear between powers of two
+    int shift = v >> 16;
+    uint64_t mantissa = (1u << 16) + (v & 0xFFFF);
+    if (shift >= 48)
+    {
+        return UINT32_MAX;
+    }
+    uint64_t result = (mantissa << shift) >> 16;
+    return (result > UINT32_MAX) ? UINT32_MAX : (uint32_t)result;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+
+// Levels are log2 of a bucket magnitude, Q16
+#define FFT_AGC_ONE_DOUBLING (1 << 16)
+
+/*
+ * Tracks a running percentile of the bucket magnitudes. Every bucket of
+ * every frame is one observation: above the level it pushes the level up by
+ * up_q16, otherwise down by down_q16. The level settles where the two
+ * balance, which is where the chosen share of observations lies below it.
+ * Working on log2 of the magnitude makes the speed independent of volume.
+ */
+typedef struct
+{
+    int32_t level_q16;
+    int32_t up_q16;
+    int32_t down_q16;
+    int32_t min_q16;
+    int32_t max_q16;
+    uint32_t percentile;
+} fft_agc_t;
+
+void fft_agc_init(fft_agc_t *agc, uint32_t percentile, uint32_t min_level, uint32_t max_level);
+void fft_agc_set_rate(fft_agc_t *agc, float frames_per_s, int num_buckets);
+void fft_agc_update(fft_agc_t *agc, const uint32_t mags[], int num_buckets);
+uint32_t fft_agc_reference(const fft_agc_t *agc);
+
+/**
+ * @brief Approximate log2 in Q8, exact at powers of two and linear in between
+ * @param v Value, must not be 0
+ */
+static inline uint32_t fft_log2_q8(uint32_t v)
+{
+    // Integer part from the leading one, fraction from the next 8 bits
+    int msb = 31 - __builtin_clz(v);
+    uint32_t frac = (msb >= 8) ? (v >> (msb - 8)) : (v << (8 - msb));
+    return ((uint32_t)msb << 8) | (frac & 0xFF);
+}
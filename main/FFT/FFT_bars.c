@@ -0,0 +1,140 @@
+#include "FFT_bars.h"
+
+#include <stddef.h>
+#include <math.h>
+
+#define FFT_BARS_DEFAULT_ATTACK_MS 10
+#define FFT_BARS_DEFAULT_RELEASE_MS 150
+#define FFT_BARS_DEFAULT_PEAK_HOLD_MS 400
+#define FFT_BARS_DEFAULT_PEAK_FALL 16
+
+// Function Prototypes
+static uint16_t time_constant_q15(uint32_t ms, uint32_t rate_hz);
+
+// Public Functions
+
+/**
+ * @brief Clears all bars and sets the default time constants
+ * @param bars Bars to initialize
+ * @param rate_hz Rate at which fft_bars_step() will be called
+ */
+void fft_bars_init(fft_bars_t *bars, uint32_t rate_hz)
+{
+    for (int i = 0; i < FFT_BARS_MAX_BARS; i++)
+    {
+        bars->target[i] = 0;
+        bars->level[i] = 0;
+        bars->peak[i] = 0;
+        bars->hold[i] = 0;
+    }
+    bars->rate_hz = (rate_hz > 0) ? rate_hz : 1;
+    fft_bars_set_smoothing(bars, FFT_BARS_DEFAULT_ATTACK_MS, FFT_BARS_DEFAULT_RELEASE_MS);
+    fft_bars_set_peak_hold(bars, FFT_BARS_DEFAULT_PEAK_HOLD_MS, FFT_BARS_DEFAULT_PEAK_FALL);
+}
+
+/**
+ * @brief Changes the rate fft_bars_step() is called at, keeping the time
+ * constants and peak timing the same in ms
+ */
+void fft_bars_set_rate(fft_bars_t *bars, uint32_t rate_hz)
+{
+    bars->rate_hz = (rate_hz > 0) ? rate_hz : 1;
+    fft_bars_set_smoothing(bars, bars->attack_ms, bars->release_ms);
+    fft_bars_set_peak_hold(bars, bars->peak_hold_ms, bars->peak_fall_rows_per_s);
+}
+
+/**
+ * @brief Sets the rise and fall time constants, 0 follows the target immediately
+ */
+void fft_bars_set_smoothing(fft_bars_t *bars, uint32_t attack_ms, uint32_t release_ms)
+{
+    bars->attack_ms = attack_ms;
+    bars->release_ms = release_ms;
+    bars->attack_q15 = time_constant_q15(attack_ms, bars->rate_hz);
+    bars->release_q15 = time_constant_q15(release_ms, bars->rate_hz);
+}
+
+/**
+ * @brief Sets how long peak dots stay at their highest level and how fast
+ * they fall afterwards
+ */
+void fft_bars_set_peak_hold(fft_bars_t *bars, uint32_t hold_ms, uint32_t fall_rows_per_s)
+{
+    bars->peak_hold_ms = hold_ms;
+    bars->peak_fall_rows_per_s = fall_rows_per_s;
+    uint32_t steps = (hold_ms * bars->rate_hz + 500) / 1000;
+    uint32_t fall = (fall_rows_per_s * FFT_BARS_ONE_ROW + bars->rate_hz / 2) / bars->rate_hz;
+    bars->peak_hold_steps = (steps > UINT16_MAX) ? UINT16_MAX : steps;
+    bars->peak_fall = (fall > FFT_BARS_MAX_HEIGHT) ? FFT_BARS_MAX_HEIGHT : (fall == 0) ? 1 : fall;
+}
+
+/**
+ * @brief Sets the heights the bars move toward (FFT task side)
+ * @param heights count heights in Q8 rows, clamped to FFT_BARS_MAX_HEIGHT
+ * @param count Bars to set from the first, at most FFT_BARS_MAX_BARS. The
+ * rest fall to 0.
+ */
+void fft_bars_set_target(fft_bars_t *bars, const uint16_t heights[], int count)
+{
+    count = (count > FFT_BARS_MAX_BARS) ? FFT_BARS_MAX_BARS : count;
+    for (int i = count; i < FFT_BARS_MAX_BARS; i++)
+    {
+        bars->target[i] = 0;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        bars->target[i] = (heights[i] > FFT_BARS_MAX_HEIGHT) ? FFT_BARS_MAX_HEIGHT : heights[i];
+    }
+}
+
+/**
+ * @brief Advances the envelopes and peaks by one step (renderer side)
+ */
+void fft_bars_step(fft_bars_t *bars)
+{
+    for (int i = 0; i < FFT_BARS_MAX_BARS; i++)
+    {
+        int32_t level = bars->level[i];
+        int32_t diff = (int32_t)bars->target[i] - level;
+        if (diff > 0)
+        {
+            // Round away from the current level so the target is always reached
+            level += (diff * bars->attack_q15 + 32767) >> 15;
+        }
+        else if (diff < 0)
+        {
+            level += (diff * bars->release_q15) >> 15;
+        }
+        bars->level[i] = (uint16_t)level;
+
+        int32_t peak = bars->peak[i];
+        if (level >= peak)
+        {
+            peak = level;
+            bars->hold[i] = bars->peak_hold_steps;
+        }
+        else if (bars->hold[i] > 0)
+        {
+            bars->hold[i]--;
+        }
+        else
+        {
+            peak -= bars->peak_fall;
+            peak = (peak > level) ? peak : level;
+        }
+        bars->peak[i] = (uint16_t)peak;
+    }
+}
+
+// Private Functions
+static uint16_t time_constant_q15(uint32_t ms, uint32_t rate_hz)
+{
+    // One pole smoother: covers 1 - 1/e of a step change in ms milliseconds
+    if (ms == 0)
+    {
+        return 32767;
+    }
+    double coeff = 1.0 - exp(-1000.0 / ((double)ms * rate_hz));
+    long q15 = lrint(coeff * 32768.0);
+    return (q15 < 1) ? 1 : (q15 > 32767) ? 32767 : (uint16_t)q15;
+}
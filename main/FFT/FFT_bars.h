@@ -0,0 +1,50 @@
+#pragma once
+#include <stdint.h>
+#include "FFT_spectrum.h"
+
+// Bar heights are in Q8 display rows
+#define FFT_BARS_ONE_ROW 256
+#define FFT_BARS_MAX_HEIGHT (FRAME_BUF_ROWS * FFT_BARS_ONE_ROW)
+// One bar per bucket and channel
+#define FFT_BARS_MAX_BARS (2 * FFT_BUCKETS)
+
+/*
+ * Per column envelope between the FFT and the drawers. The FFT task sets a
+ * target height per frame, the renderer steps the envelope once per display
+ * refresh: bars rise toward the target with the attack time constant and
+ * fall with the release one, so refreshes between FFT frames show
+ * intermediate heights. A peak dot holds the highest level for a while,
+ * then falls at a fixed rate. Times are kept in ms so the per step values
+ * can be worked out again when the refresh rate changes.
+ */
+typedef struct
+{
+    volatile uint16_t target[FFT_BARS_MAX_BARS]; // Written by the FFT task, each entry on its own
+    uint16_t level[FFT_BARS_MAX_BARS];
+    uint16_t peak[FFT_BARS_MAX_BARS];
+    uint16_t hold[FFT_BARS_MAX_BARS];            // Steps left before the peak starts falling
+    uint32_t rate_hz;                      // Steps per second
+    uint16_t attack_q15;                   // Fraction of the distance to the target covered per step
+    uint16_t release_q15;
+    uint16_t peak_hold_steps;
+    uint16_t peak_fall;                    // Q8 rows per step
+    uint32_t attack_ms;
+    uint32_t release_ms;
+    uint32_t peak_hold_ms;
+    uint32_t peak_fall_rows_per_s;
+} fft_bars_t;
+
+void fft_bars_init(fft_bars_t *bars, uint32_t rate_hz);
+void fft_bars_set_rate(fft_bars_t *bars, uint32_t rate_hz);
+void fft_bars_set_smoothing(fft_bars_t *bars, uint32_t attack_ms, uint32_t release_ms);
+void fft_bars_set_peak_hold(fft_bars_t *bars, uint32_t hold_ms, uint32_t fall_rows_per_s);
+void fft_bars_set_target(fft_bars_t *bars, const uint16_t heights[], int count);
+void fft_bars_step(fft_bars_t *bars);
+
+/**
+ * @brief Number of whole rows lit by a Q8 height, any fraction of a row lights it
+ */
+static inline uint8_t fft_bars_rows(uint16_t height)
+{
+    return (uint8_t)((height + FFT_BARS_ONE_ROW - 1) / FFT_BARS_ONE_ROW);
+}
@@ -0,0 +1,176 @@
+#include "FFT_beat.h"
+#include "FFT_agc.h"
+
+#include <stddef.h>
+
+// Onset when the flux exceeds the average by this ratio (Q8) plus FFT_BEAT_MIN_FLUX
+#define FFT_BEAT_THRESHOLD_Q8 384
+// Smallest flux that can be an onset, in Q8 doublings summed over the buckets
+#define FFT_BEAT_MIN_FLUX (4 * 256)
+// Intervals needed before a tempo is reported
+#define FFT_BEAT_MIN_INTERVALS (FFT_BEAT_INTERVALS / 2)
+
+// Function Prototypes
+static uint32_t fold_interval(const fft_beat_t *beat, uint32_t interval);
+static uint32_t estimate_bpm(const fft_beat_t *beat);
+static void clear_tempo(fft_beat_t *beat);
+
+// Public Functions
+
+/**
+ * @brief Clears the detector, call fft_beat_set_rate() before the first update
+ * @param beat Detector to initialize
+ * @param min_level Bucket magnitudes below this are treated as silence
+ */
+void fft_beat_init(fft_beat_t *beat, uint32_t min_level)
+{
+    beat->floor_q8 = (uint16_t)fft_log2_q8((min_level > 0) ? min_level : 1);
+    for (int i = 0; i < FFT_BUCKETS; i++)
+    {
+        beat->prev_q8[i] = beat->floor_q8;
+    }
+    for (int i = 0; i < FFT_BEAT_HISTORY; i++)
+    {
+        beat->flux[i] = 0;
+    }
+    beat->flux_sum = 0;
+    beat->frame = 0;
+    beat->last_onset = 0;
+    beat->have_onset = false;
+    beat->frames_per_s = 0.0f;
+    beat->min_period = 1;
+    beat->max_period = 1;
+    clear_tempo(beat);
+}
+
+/**
+ * @brief Sets the frame rate the periods are counted in, must be called
+ * again whenever it changes. Clears the tempo estimate.
+ */
+void fft_beat_set_rate(fft_beat_t *beat, float frames_per_s)
+{
+    if (frames_per_s <= 0)
+    {
+        return;
+    }
+    beat->frames_per_s = frames_per_s;
+    beat->min_period = (uint32_t)(frames_per_s * 60 / FFT_BEAT_MAX_BPM);
+    beat->max_period = (uint32_t)(frames_per_s * 60 / FFT_BEAT_MIN_BPM);
+    beat->min_period = (beat->min_period < 1) ? 1 : beat->min_period;
+    beat->max_period = (beat->max_period < 2 * beat->min_period) ? 2 * beat->min_period : beat->max_period;
+    clear_tempo(beat);
+}
+
+/**
+ * @brief Takes one frame of bucket magnitudes, O(num_buckets)
+ * @param num_buckets At most FFT_BUCKETS
+ * @return true if the frame is an onset
+ */
+bool fft_beat_update(fft_beat_t *beat, const uint32_t mags[], int num_buckets)
+{
+    num_buckets = (num_buckets > FFT_BUCKETS) ? FFT_BUCKETS : num_buckets;
+    uint32_t flux = 0;
+    for (int i = 0; i < num_buckets; i++)
+    {
+        uint32_t level = (mags[i] > 0) ? fft_log2_q8(mags[i]) : 0;
+        level = (level > beat->floor_q8) ? level : beat->floor_q8;
+        flux += (level > beat->prev_q8[i]) ? level - beat->prev_q8[i] : 0;
+        beat->prev_q8[i] = (uint16_t)level;
+    }
+
+    // Compare against the history before adding this frame to it
+    uint32_t frames = (beat->frame < FFT_BEAT_HISTORY) ? beat->frame : FFT_BEAT_HISTORY;
+    uint32_t average = (frames > 0) ? beat->flux_sum / frames : 0;
+    uint32_t threshold = ((uint64_t)average * FFT_BEAT_THRESHOLD_Q8 >> 8) + FFT_BEAT_MIN_FLUX;
+    int slot = beat->frame & (FFT_BEAT_HISTORY - 1);
+    beat->flux_sum += flux - beat->flux[slot];
+    beat->flux[slot] = flux;
+    uint32_t frame = beat->frame++;
+
+    uint32_t since = frame - beat->last_onset;
+    if (beat->have_onset && since > 2 * beat->max_period)
+    {
+        // Lost the beat, start the estimate over with the next onsets
+        clear_tempo(beat);
+    }
+    if (frame == 0)
+    {
+        // The first frame only primes prev_q8
+        return false;
+    }
+    if (flux < threshold || (beat->have_onset && since < beat->min_period))
+    {
+        return false;
+    }
+
+    if (beat->have_onset && since <= 2 * beat->max_period)
+    {
+        beat->intervals[beat->next_interval] = (uint16_t)fold_interval(beat, since);
+        beat->next_interval = (beat->next_interval + 1) % FFT_BEAT_INTERVALS;
+        if (beat->num_intervals < FFT_BEAT_INTERVALS)
+        {
+            beat->num_intervals++;
+        }
+        if (beat->num_intervals >= FFT_BEAT_MIN_INTERVALS)
+        {
+            beat->bpm = estimate_bpm(beat);
+        }
+    }
+    beat->last_onset = frame;
+    beat->have_onset = true;
+    return true;
+}
+
+// Private Functions
+static uint32_t fold_interval(const fft_beat_t *beat, uint32_t interval)
+{
+    // Onsets on off beats or skipped beats still count toward the same tempo
+    while (interval > beat->max_period)
+    {
+        interval /= 2;
+    }
+    while (interval < beat->min_period)
+    {
+        interval *= 2;
+    }
+    return interval;
+}
+
+static uint32_t estimate_bpm(const fft_beat_t *beat)
+{
+    // Median interval, then the mean of those within a frame of it for a
+    // finer estimate than whole frames
+    int n = beat->num_intervals;
+    uint16_t sorted[FFT_BEAT_INTERVALS];
+    for (int i = 0; i < n; i++)
+    {
+        uint16_t v = beat->intervals[i];
+        int j = i;
+        for (; j > 0 && sorted[j - 1] > v; j--)
+        {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = v;
+    }
+    uint32_t median = sorted[n / 2];
+
+    uint32_t sum = 0;
+    uint32_t count = 0;
+    for (int i = 0; i < n; i++)
+    {
+        uint32_t v = sorted[i];
+        if (v + 1 >= median && v <= median + 1)
+        {
+            sum += v;
+            count++;
+        }
+    }
+    return (uint32_t)(beat->frames_per_s * 60 * count / sum + 0.5f);
+}
+
+static void clear_tempo(fft_beat_t *beat)
+{
+    beat->num_intervals = 0;
+    beat->next_interval = 0;
+    beat->bpm = 0;
+}
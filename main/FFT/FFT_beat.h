@@ -0,0 +1,50 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "FFT_spectrum.h"
+
+// Flux frames the onset threshold averages over, power of two
+#define FFT_BEAT_HISTORY 64
+// Onset intervals the tempo is estimated from
+#define FFT_BEAT_INTERVALS 8
+#define FFT_BEAT_MIN_BPM 60
+#define FFT_BEAT_MAX_BPM 180
+
+/*
+ * Spectral flux onset detector and tempo tracker over the bucket magnitudes.
+ * The flux of a frame is the sum of the rises in log2 magnitude of every
+ * bucket since the previous frame. A frame is an onset when its flux is well
+ * above the average of the last FFT_BEAT_HISTORY frames and the previous
+ * onset is at least one beat at FFT_BEAT_MAX_BPM ago. The tempo comes from
+ * the intervals between the last onsets, folded into the BPM range by
+ * doubling or halving.
+ */
+typedef struct
+{
+    uint16_t prev_q8[FFT_BUCKETS];        // log2 of the previous frame's magnitudes
+    uint16_t floor_q8;                    // Magnitudes below this count as silence
+    uint32_t flux[FFT_BEAT_HISTORY];
+    uint32_t flux_sum;
+    uint32_t frame;                       // Free running frame count
+    uint32_t last_onset;                  // Frame of the last onset
+    bool have_onset;
+    uint16_t intervals[FFT_BEAT_INTERVALS]; // Frames between onsets, folded into the BPM range
+    int num_intervals;
+    int next_interval;
+    float frames_per_s;
+    uint32_t min_period;                  // Frames per beat at FFT_BEAT_MAX_BPM
+    uint32_t max_period;                  // Frames per beat at FFT_BEAT_MIN_BPM
+    uint32_t bpm;                         // 0 until enough onsets were seen
+} fft_beat_t;
+
+void fft_beat_init(fft_beat_t *beat, uint32_t min_level);
+void fft_beat_set_rate(fft_beat_t *beat, float frames_per_s);
+bool fft_beat_update(fft_beat_t *beat, const uint32_t mags[], int num_buckets);
+
+/**
+ * @brief Tempo estimate in beats per minute, 0 while unknown
+ */
+static inline uint32_t fft_beat_bpm(const fft_beat_t *beat)
+{
+    return beat->bpm;
+}
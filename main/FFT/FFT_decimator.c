@@ -0,0 +1,87 @@
+#include "FFT_decimator.h"
+
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+// Function Prototypes
+static void design_taps(int16_t *taps, int factor);
+
+// Public Functions
+
+/**
+ * @brief Designs the filters for every factor and selects one
+ * @param dec Decimator to initialize
+ * @param factor 1, 2 or 4
+ */
+void fft_decimator_init(fft_decimator_t *dec, int factor)
+{
+    design_taps(&dec->taps_2[0][0], 2);
+    design_taps(&dec->taps_4[0][0], 4);
+    if (fft_decimator_set_factor(dec, factor) < 0)
+    {
+        fft_decimator_set_factor(dec, 1);
+    }
+}
+
+/**
+ * @brief Switches the decimation factor and clears the filter state. Must be
+ * called from the context that calls fft_decimator_push().
+ * @return 0 on success, -1 for an unsupported factor
+ */
+int fft_decimator_set_factor(fft_decimator_t *dec, int factor)
+{
+    switch (factor)
+    {
+    case 1:
+        dec->taps = NULL;
+        break;
+    case 2:
+        dec->taps = &dec->taps_2[0][0];
+        break;
+    case 4:
+        dec->taps = &dec->taps_4[0][0];
+        break;
+    default:
+        return -1;
+    }
+
+    dec->factor = factor;
+    dec->phase = factor - 1;
+    dec->pos = FFT_DECIMATOR_TAPS_PER_PHASE - 1;
+    memset(dec->delay, 0, sizeof(dec->delay));
+    return 0;
+}
+
+// Private Functions
+static void design_taps(int16_t *taps, int factor)
+{
+    /*
+     * Prototype h[i], i = 0 .. N-1, is split into branches
+     * taps[b][k] = h[k * factor + b], so that with branch b fed
+     * x[m * factor - b] the branch outputs sum to the full convolution
+     */
+    const int K = FFT_DECIMATOR_TAPS_PER_PHASE;
+    int n = factor * K;
+    double h[FFT_DECIMATOR_MAX_FACTOR * FFT_DECIMATOR_TAPS_PER_PHASE];
+    double fc = 0.5 / factor;
+    double sum = 0.0;
+
+    for (int i = 0; i < n; i++)
+    {
+        double t = i - (n - 1) / 2.0;
+        double sinc = (t == 0.0) ? 2.0 * fc : sin(2.0 * M_PI * fc * t) / (M_PI * t);
+        double phase = 2.0 * M_PI * i / (n - 1);
+        double window = 0.42 - 0.5 * cos(phase) + 0.08 * cos(2.0 * phase);
+        h[i] = sinc * window;
+        sum += h[i];
+    }
+
+    // Unity gain at DC
+    for (int i = 0; i < n; i++)
+    {
+        int b = i % factor;
+        int k = i / factor;
+        taps[b * K + k] = (int16_t)lrint(32767.0 * h[i] / sum);
+    }
+}
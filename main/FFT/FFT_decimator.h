@@ -0,0 +1,69 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FFT_DECIMATOR_MAX_FACTOR 4
+#define FFT_DECIMATOR_TAPS_PER_PHASE 16
+
+/*
+ * Polyphase FIR decimator, by 1 (bypass), 2 or 4. Factor f uses a
+ * f * FFT_DECIMATOR_TAPS_PER_PHASE tap Blackman windowed sinc low pass with
+ * its cutoff at the output Nyquist frequency, split into f branches of
+ * FFT_DECIMATOR_TAPS_PER_PHASE taps. Each input sample goes to one branch,
+ * and one output is produced per f inputs.
+ */
+typedef struct
+{
+    int factor;
+    int phase;  // Branch that takes the next input sample
+    int pos;    // Newest entry of the delay lines
+    const int16_t *taps;
+    int16_t taps_2[2][FFT_DECIMATOR_TAPS_PER_PHASE];  // Q15, [branch][tap]
+    int16_t taps_4[4][FFT_DECIMATOR_TAPS_PER_PHASE];
+    int16_t delay[FFT_DECIMATOR_MAX_FACTOR][2 * FFT_DECIMATOR_TAPS_PER_PHASE];  // Each entry written twice
+} fft_decimator_t;
+
+void fft_decimator_init(fft_decimator_t *dec, int factor);
+int fft_decimator_set_factor(fft_decimator_t *dec, int factor);
+
+/**
+ * @brief Feeds one input sample
+ * @param out Set to the next output sample when one is produced
+ * @return true if an output sample was produced
+ */
+static inline bool fft_decimator_push(fft_decimator_t *dec, int16_t sample, int16_t *out)
+{
+    const int K = FFT_DECIMATOR_TAPS_PER_PHASE;
+    if (dec->factor == 1)
+    {
+        *out = sample;
+        return true;
+    }
+
+    // Samples of one output period arrive for branches factor - 1 down to 0
+    int p = dec->phase;
+    dec->delay[p][dec->pos] = sample;
+    dec->delay[p][dec->pos + K] = sample;
+    if (p != 0)
+    {
+        dec->phase = p - 1;
+        return false;
+    }
+
+    int32_t acc = 1 << 14;
+    for (int b = 0; b < dec->factor; b++)
+    {
+        const int16_t *h = &dec->taps[b * K];
+        const int16_t *x = &dec->delay[b][dec->pos];
+        for (int k = 0; k < K; k++)
+        {
+            acc += h[k] * x[k];
+        }
+    }
+    dec->phase = dec->factor - 1;
+    dec->pos = (dec->pos == 0) ? K - 1 : dec->pos - 1;
+
+    acc >>= 15;
+    *out = (acc > INT16_MAX) ? INT16_MAX : (acc < INT16_MIN) ? INT16_MIN : (int16_t)acc;
+    return true;
+}
@@ -0,0 +1,90 @@
+#include "FFT_draw.h"
+
+// Public Functions
+void fft_draw_bars(display_buffer_t *buffer, const fft_bars_t *bars)
+{
+    // Bit y of a column lights row y, bars grow up from row 7. The partly
+    // filled row on top of a bar is lit at the level of its fraction.
+    uint8_t planes[FFT_BARS_DEPTH][FFT_BUCKETS];
+    const int max_level = (1 << FFT_BARS_DEPTH) - 1;
+    for (int i = 0; i < FFT_BUCKETS; i++)
+    {
+        int full = bars->level[i] / FFT_BARS_ONE_ROW;
+        int top = ((bars->level[i] % FFT_BARS_ONE_ROW) * max_level + FFT_BARS_ONE_ROW / 2) / FFT_BARS_ONE_ROW;
+        uint8_t peak = fft_bars_rows(bars->peak[i]);
+        // Rows 8 - full to 7, plus the dot in row 8 - peak, heights of 0 shift out
+        uint8_t lit = (uint8_t)((0xFF00 >> full) | (0x100 >> peak));
+        uint8_t top_row = (uint8_t)(0x80 >> full);
+        for (int p = 0; p < FFT_BARS_DEPTH; p++)
+        {
+            planes[p][i] = lit | ((top & (1 << (FFT_BARS_DEPTH - 1 - p))) ? top_row : 0);
+        }
+    }
+    buffer_draw_column_planes(buffer, (const uint8_t (*)[FRAME_BUF_COLS])planes, FFT_BARS_DEPTH);
+    buffer_update(buffer);
+}
+
+void fft_draw_bars_mirror(display_buffer_t *buffer, const fft_bars_t *bars)
+{
+    // Bars grow out from between rows 3 and 4, half the height each way
+    uint8_t columns[FFT_BUCKETS];
+    for (int i = 0; i < FFT_BUCKETS; i++)
+    {
+        uint8_t height = fft_bars_rows(bars->level[i]) / 2;
+        uint8_t peak = fft_bars_rows(bars->peak[i]) / 2;
+        // Rows 4 - height to 3 and 4 to 3 + height, dots in rows 4 - peak and 3 + peak
+        uint8_t bar = ((0xF0 >> height) & 0x0F) | ((0x0F0 << height) >> 4 & 0xF0);
+        uint8_t dot = ((0x10 >> peak) & 0x0F) | ((0x08 << peak) & 0xF0);
+        columns[i] = bar | dot;
+    }
+    buffer_draw_columns(buffer, columns);
+    buffer_update(buffer);
+}
+
+void fft_draw_columns(display_buffer_t *buffer, const uint8_t columns[FFT_BUCKETS])
+{
+    // Modes that work out their columns on the FFT task, bit y lights row y
+    buffer_draw_columns(buffer, columns);
+    buffer_update(buffer);
+}
+
+void fft_draw_vu(display_buffer_t *buffer, const fft_bars_t *bars)
+{
+    // Left channel on rows 1-2, right channel on rows 5-6. RMS bars grow
+    // from the left, the held sample peak is a dot on the same rows.
+    uint8_t columns[FFT_BUCKETS];
+    int len[2];
+    int peak[2];
+    for (int c = 0; c < 2; c++)
+    {
+        len[c] = (bars->level[c] * FFT_BUCKETS + FFT_BARS_MAX_HEIGHT - 1) / FFT_BARS_MAX_HEIGHT;
+        peak[c] = (bars->peak[2 + c] * FFT_BUCKETS + FFT_BARS_MAX_HEIGHT - 1) / FFT_BARS_MAX_HEIGHT;
+    }
+    for (int x = 0; x < FFT_BUCKETS; x++)
+    {
+        uint8_t left = (x < len[0] || x == peak[0] - 1) ? 0x06 : 0x00;
+        uint8_t right = (x < len[1] || x == peak[1] - 1) ? 0x60 : 0x00;
+        columns[x] = left | right;
+    }
+    buffer_draw_columns(buffer, columns);
+    buffer_update(buffer);
+}
+
+void fft_draw_stereo(display_buffer_t *buffer, const fft_bars_t *bars)
+{
+    // Left channel grows up from row 3, right channel down from row 4, each
+    // at half height. Right channel bars follow the left ones in bars.
+    uint8_t columns[FFT_BUCKETS];
+    for (int i = 0; i < FFT_BUCKETS; i++)
+    {
+        uint8_t left = fft_bars_rows(bars->level[i]) / 2;
+        uint8_t right = fft_bars_rows(bars->level[FFT_BUCKETS + i]) / 2;
+        uint8_t left_peak = fft_bars_rows(bars->peak[i]) / 2;
+        uint8_t right_peak = fft_bars_rows(bars->peak[FFT_BUCKETS + i]) / 2;
+        uint8_t bar = ((0xF0 >> left) & 0x0F) | ((0x0F0 << right) >> 4 & 0xF0);
+        uint8_t dot = ((0x10 >> left_peak) & 0x0F) | ((0x08 << right_peak) & 0xF0);
+        columns[i] = bar | dot;
+    }
+    buffer_draw_columns(buffer, columns);
+    buffer_update(buffer);
+}
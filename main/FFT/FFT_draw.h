@@ -0,0 +1,19 @@
+#pragma once
+#include <stdint.h>
+#include "FFT_bars.h"
+#include "FrameBuffer.h"
+
+// Bits per pixel of the bar tops
+#define FFT_BARS_DEPTH 2
+
+/*
+ * Drawers of the FFT display modes. Each one draws a whole frame from the
+ * bar envelope into the write buffer and publishes it with buffer_update().
+ * They run on the display task once per refresh and touch nothing else, so
+ * the host display simulator links them as they are.
+ */
+void fft_draw_bars(display_buffer_t *buffer, const fft_bars_t *bars);
+void fft_draw_bars_mirror(display_buffer_t *buffer, const fft_bars_t *bars);
+void fft_draw_vu(display_buffer_t *buffer, const fft_bars_t *bars);
+void fft_draw_stereo(display_buffer_t *buffer, const fft_bars_t *bars);
+void fft_draw_columns(display_buffer_t *buffer, const uint8_t columns[FFT_BUCKETS]);
@@ -0,0 +1,326 @@
+#include "FFT_fixed.h"
+
+#include <stdlib.h>
+#include <math.h>
+
+/*
+ * Fixed point real FFT with block floating point scaling
+ *
+ * The n real Q15 samples are treated as n / 2 complex samples and
+ * transformed in place by radix-2 DIT stages on int16 data, with 32 bit
+ * intermediates. Each stage tracks an upper bound of its output magnitudes
+ * and the next stage shifts its results right by just enough to stay in
+ * range (a radix-2 butterfly can grow a component by up to 1 + sqrt(2)).
+ * The shifts are summed into a block exponent. The final real/complex
+ * split also runs in place and scales by 1/4, so the whole transform needs
+ * no memory besides the caller's buffer.
+ */
+
+#define FFT_Q15_OWN_DATA_MEM 1
+#define FFT_Q15_OWN_TWIDDLE_MEM 4
+
+// Function Prototypes
+static int complex_fft(int16_t *z, int m, const int16_t *twiddle_factors);
+static void bit_reverse(int16_t *x, int n);
+static uint32_t first_stage(int16_t *x, int n);
+static uint32_t stage(int16_t *x, int n, int half, const int16_t *twiddle_factors, int shift);
+static void rfft_postprocess(int16_t *y, const int16_t *twiddle_factors, int n);
+static void stereo_postprocess(int16_t *y, int n);
+
+// Public Functions
+
+/**
+ * @brief Creates a fixed point forward real FFT plan
+ * @param size FFT size, power of two of at least 8
+ * @param data Buffer of size samples, transformed in place, allocated if NULL
+ * @return Plan or NULL on failure
+ */
+fft_q15_config_t *fft_q15_init(int size, int16_t *data)
+{
+    if (size < 8 || (size & (size - 1)) != 0)
+    {
+        return NULL;
+    }
+
+    fft_q15_config_t *config = (fft_q15_config_t *)calloc(1, sizeof(fft_q15_config_t));
+    if (config == NULL)
+    {
+        return NULL;
+    }
+    config->size = size;
+    config->flags = FFT_Q15_OWN_TWIDDLE_MEM;
+
+    // Real split twiddles (n / 4 pairs), then the complex stages' twiddles,
+    // half = 2 .. n / 4 with half pairs each. Same layout as FFT_tables.c.
+    int m = size / 2;
+    int16_t *twiddle_factors = (int16_t *)malloc((size / 2 + 2 * (m - 2)) * sizeof(int16_t));
+    config->twiddle_factors = twiddle_factors;
+    config->data = data;
+    if (config->data == NULL)
+    {
+        config->data = (int16_t *)malloc(size * sizeof(int16_t));
+        config->flags |= FFT_Q15_OWN_DATA_MEM;
+    }
+    if (config->twiddle_factors == NULL || config->data == NULL)
+    {
+        fft_q15_destroy(config);
+        return NULL;
+    }
+
+    int16_t *tw = twiddle_factors;
+    for (int k = 0; k < size / 4; k++)
+    {
+        double a = 2.0 * M_PI * k / size;
+        *tw++ = (int16_t)lrint(32767.0 * cos(a));
+        *tw++ = (int16_t)lrint(32767.0 * sin(a));
+    }
+    for (int half = 2; half < m; half *= 2)
+    {
+        for (int k = 0; k < half; k++)
+        {
+            double a = M_PI * k / half;
+            *tw++ = (int16_t)lrint(32767.0 * cos(a));
+            *tw++ = (int16_t)lrint(32767.0 * sin(a));
+        }
+    }
+    return config;
+}
+
+void fft_q15_destroy(fft_q15_config_t *config)
+{
+    if (config == NULL)
+    {
+        return;
+    }
+    if (config->flags & FFT_Q15_OWN_DATA_MEM)
+    {
+        free(config->data);
+    }
+    if (config->flags & FFT_Q15_OWN_TWIDDLE_MEM)
+    {
+        free((void *)config->twiddle_factors);
+    }
+    free(config);
+}
+
+/**
+ * @brief Runs the forward real FFT in place on config->data
+ * @return Block exponent e, the output holds the DFT of the input divided by 2^e
+ */
+int fft_q15_execute(fft_q15_config_t *config)
+{
+    int n = config->size;
+    int exponent = complex_fft(config->data, n / 2, config->twiddle_factors + n / 2);
+    rfft_postprocess(config->data, config->twiddle_factors, n);
+    return exponent + 2;
+}
+
+/**
+ * @brief Transforms two real signals of size / 2 samples with the plan of a
+ * size point real FFT, in place on config->data. The left channel goes in
+ * as the real and the right as the imaginary part of a size / 2 point
+ * complex FFT, the two spectra are then separated using their conjugate
+ * symmetry, so both cost about as much as one real FFT of size samples.
+ * @param config Plan of the real FFT, data holds size / 2 interleaved
+ * left/right sample pairs
+ * @return Block exponent e. data holds the packed size / 2 point spectrum of
+ * the left channel followed by the one of the right, each in the layout of
+ * fft_q15_execute() and divided by 2^e.
+ */
+int fft_q15_execute_stereo(fft_q15_config_t *config)
+{
+    int n = config->size;
+    int exponent = complex_fft(config->data, n / 2, config->twiddle_factors + n / 2);
+    stereo_postprocess(config->data, n);
+    return exponent + 1;
+}
+
+// Private Functions
+static int complex_fft(int16_t *z, int m, const int16_t *twiddle_factors)
+{
+    // m point complex FFT in place, returns the sum of the stage shifts
+    bit_reverse(z, m);
+    uint32_t bits = first_stage(z, m);
+
+    int exponent = 0;
+    const int16_t *tw = twiddle_factors;
+    for (int half = 2; half < m; half *= 2)
+    {
+        // bits bounds the largest magnitude, keep (1 + sqrt(2)) * max below 2^15
+        int shift = (bits >= 16384) ? 2 : (bits >= 8192) ? 1 : 0;
+        bits = stage(z, m, half, tw, shift);
+        exponent += shift;
+        tw += 2 * half;
+    }
+    return exponent;
+}
+
+static void bit_reverse(int16_t *x, int n)
+{
+    // In place permutation of n complex values, swaps each pair once
+    int32_t *c = (int32_t *)x;
+    for (int i = 0, j = 0; i < n; i++)
+    {
+        if (i < j)
+        {
+            int32_t t = c[i];
+            c[i] = c[j];
+            c[j] = t;
+        }
+        int bit = n >> 1;
+        while (j & bit)
+        {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+}
+
+static inline uint32_t abs_bits(int32_t v)
+{
+    // |v| rounded up to an all ones bit pattern when OR-ed together
+    return (uint32_t)(v ^ (v >> 31));
+}
+
+static uint32_t first_stage(int16_t *x, int n)
+{
+    // Twiddle free butterflies on Q15 input, scaled by 1/2 so they can't overflow
+    uint32_t bits = 0;
+    for (int i = 0; i < 2 * n; i += 4)
+    {
+        int32_t ar = x[i];
+        int32_t ai = x[i + 1];
+        int32_t br = x[i + 2];
+        int32_t bi = x[i + 3];
+        int32_t y0r = (ar + br) >> 1;
+        int32_t y0i = (ai + bi) >> 1;
+        int32_t y1r = (ar - br) >> 1;
+        int32_t y1i = (ai - bi) >> 1;
+        x[i] = (int16_t)y0r;
+        x[i + 1] = (int16_t)y0i;
+        x[i + 2] = (int16_t)y1r;
+        x[i + 3] = (int16_t)y1i;
+        bits |= abs_bits(y0r) | abs_bits(y0i) | abs_bits(y1r) | abs_bits(y1i);
+    }
+    return bits;
+}
+
+static uint32_t stage(int16_t *x, int n, int half, const int16_t *twiddle_factors, int shift)
+{
+    uint32_t bits = 0;
+    for (int g = 0; g < 2 * n; g += 4 * half)
+    {
+        int16_t *p0 = x + g;
+        int16_t *p1 = p0 + 2 * half;
+        const int16_t *w = twiddle_factors;
+        for (int k = 0; k < 2 * half; k += 2, w += 2)
+        {
+            // b * W^k, W^k = cos(a) - j sin(a)
+            int32_t c = w[0];
+            int32_t s = w[1];
+            int32_t br = p1[k];
+            int32_t bi = p1[k + 1];
+            int32_t tr = (c * br + s * bi + (1 << 14)) >> 15;
+            int32_t ti = (c * bi - s * br + (1 << 14)) >> 15;
+
+            int32_t ar = p0[k];
+            int32_t ai = p0[k + 1];
+            int32_t y0r = (ar + tr) >> shift;
+            int32_t y0i = (ai + ti) >> shift;
+            int32_t y1r = (ar - tr) >> shift;
+            int32_t y1i = (ai - ti) >> shift;
+            p0[k] = (int16_t)y0r;
+            p0[k + 1] = (int16_t)y0i;
+            p1[k] = (int16_t)y1r;
+            p1[k + 1] = (int16_t)y1i;
+            bits |= abs_bits(y0r) | abs_bits(y0i) | abs_bits(y1r) | abs_bits(y1i);
+        }
+    }
+    return bits;
+}
+
+static void rfft_postprocess(int16_t *y, const int16_t *twiddle_factors, int n)
+{
+    /*
+     * Same split as the float rfft, see rfft_postprocess() in FFT.c, in
+     * place. The complex transform was scaled by 1/2 in its first stage,
+     * which the missing 0.5 factors here make up for, the results are then
+     * scaled by 1/4 to fit 16 bits (the extra 2 in the block exponent).
+     * A stage only skips its shift when its inputs are below 2^13, so its
+     * outputs stay below (1 + sqrt(2)) * 2^13, about 19.8k. The sums here
+     * then stay below 39.6k and the twiddle products below 56k, both well
+     * inside 32 bits, and a quarter of their sum fits 16 bits.
+     */
+    int32_t z0r = y[0];
+    int32_t z0i = y[1];
+    y[0] = (int16_t)((z0r + z0i) >> 1);  // DC coefficient
+    y[1] = (int16_t)((z0r - z0i) >> 1);  // Center coefficient
+    y[n / 2] = (int16_t)(y[n / 2] >> 1);
+    y[n / 2 + 1] = (int16_t)(-y[n / 2 + 1] >> 1);
+
+    for (int k = 2; k < n / 2; k += 2)
+    {
+        int32_t c = twiddle_factors[k];
+        int32_t s = twiddle_factors[k + 1];
+
+        int32_t xer = (int32_t)y[k] + y[n - k];
+        int32_t xei = (int32_t)y[k + 1] - y[n - k + 1];
+        int32_t x0r = (int32_t)y[k + 1] + y[n - k + 1];
+        int32_t xoi = (int32_t)y[n - k] - y[k];
+
+        int32_t tr = (c * x0r + s * xoi + (1 << 14)) >> 15;
+        int32_t ti = (c * xoi - s * x0r + (1 << 14)) >> 15;
+
+        y[k] = (int16_t)((xer + tr) >> 2);
+        y[k + 1] = (int16_t)((xei + ti) >> 2);
+        y[n - k] = (int16_t)((xer - tr) >> 2);
+        y[n - k + 1] = (int16_t)((ti - xei) >> 2);
+    }
+}
+
+static void stereo_postprocess(int16_t *y, int n)
+{
+    /*
+     * With z = l + j r, L[k] = (Z[k] + Z*[m - k]) / 2 and
+     * R[k] = (Z[k] - Z*[m - k]) / 2j. The first stage already scaled Z by
+     * 1/2, which makes up for the 1/2 here. Stage outputs only stay below
+     * (1 + sqrt(2)) * 2^13, about 19.8k, so a sum of two may not fit 16 bits:
+     * the sums are halved instead and the block exponent grows by 1.
+     *
+     * L[k] is written over Z[k] and R[k] over Z[m - k], which leaves the
+     * first half of the buffer in the packed layout for the left channel
+     * and the second half holding the right channel's bins in reverse.
+     */
+    int m = n / 2;
+    int16_t *upper = y + m;
+    int32_t dc_r = y[0];
+    int32_t dc_i = y[1];
+    int32_t nyq_r = upper[0];
+    int32_t nyq_i = upper[1];
+
+    for (int k = 1; k < m / 2; k++)
+    {
+        int32_t ar = y[2 * k];
+        int32_t ai = y[2 * k + 1];
+        int32_t br = y[2 * (m - k)];
+        int32_t bi = y[2 * (m - k) + 1];
+        y[2 * k] = (int16_t)((ar + br) >> 1);
+        y[2 * k + 1] = (int16_t)((ai - bi) >> 1);
+        y[2 * (m - k)] = (int16_t)((ai + bi) >> 1);
+        y[2 * (m - k) + 1] = (int16_t)((br - ar) >> 1);
+    }
+
+    // Reverse the right channel's bins, then pack DC and Nyquist like rfft
+    int32_t *c = (int32_t *)upper;
+    for (int i = 1, j = m / 2 - 1; i < j; i++, j--)
+    {
+        int32_t t = c[i];
+        c[i] = c[j];
+        c[j] = t;
+    }
+    y[0] = (int16_t)dc_r;
+    y[1] = (int16_t)nyq_r;
+    upper[0] = (int16_t)dc_i;
+    upper[1] = (int16_t)nyq_i;
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+#include "FFT_tables.h"
+
+typedef struct
+{
+    int size;                  // Real FFT size
+    int16_t *data;             // Real Q15 samples in, packed spectrum (same layout as the float real FFT) out
+    const int16_t *twiddle_factors; // Q15, stored in the order they are read
+    unsigned int flags;
+} fft_q15_config_t;
+
+fft_q15_config_t *fft_q15_init(int size, int16_t *data);
+void fft_q15_destroy(fft_q15_config_t *config);
+int fft_q15_execute(fft_q15_config_t *config);
+int fft_q15_execute_stereo(fft_q15_config_t *config);
+
+/*
+ * Static plan using the const twiddles from FFT_tables.c (flash), N must be
+ * one of the generated sizes. Don't call fft_q15_destroy() on it.
+ *
+ *   static fft_q15_config_t plan = FFT_Q15_STATIC_PLAN(2048, buffer);
+ */
+#define FFT_Q15_CONCAT_(a, b) a##b
+#define FFT_Q15_CONCAT(a, b) FFT_Q15_CONCAT_(a, b)
+#define FFT_Q15_STATIC_PLAN(N, buf)                             \
+    {                                                           \
+        .size = (N),                                            \
+        .data = (buf),                                          \
+        .twiddle_factors = FFT_Q15_CONCAT(fft_q15_twiddles_, N), \
+        .flags = 0,                                             \
+    }
@@ -0,0 +1,315 @@
+#include "FFT_spectrum.h"
+
+#include <stddef.h>
+#include <math.h>
+
+// Upper frequency bound (Hz) of each display bucket
+#if defined(CONFIG_DEV_BOARD_DISPLAY)
+const uint16_t fft_bucket_ranges[FFT_BUCKETS] = {
+    50, 100, 141, 185, 233, 285, 343, 406, 476, 553,
+    637, 729, 829, 937, 1053, 1179, 1314, 1459,
+    1614, 1778, 1954, 2140, 2336, 2544, 2764, 2995,
+    3238, 3493, 3760, 4040, 4333, 4638, 4957, 5289,
+    5635, 5994, 6367, 6754, 7156, 7572, // 8002,
+};
+#elif defined(CONFIG_FORM_FACTOR_DISPLAY)
+const uint16_t fft_bucket_ranges[FFT_BUCKETS] = {
+    73, 111, 157, 212, 276, 350, 434, 529,
+    635, 753, 884, 1027, 1185, 1356, 1542, 1744,
+    1961, 2194, 2444, 2712, 2998, 3302, 3625, 3968,
+    4331, 4715, 5120, 5546, 5995, 6467, 6963, 7482
+};
+#else
+#error "Invalid display type"
+#endif
+
+static inline float hz_to_mel(float hz)
+{
+    return 2595.0f * log10f(1.0f + hz / 700.0f);
+}
+
+static inline float mel_to_hz(float mel)
+{
+    return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f);
+}
+
+static inline float triangle_weight(int k, float lo, float mid, float hi)
+{
+    float w = (k <= mid) ? (k - lo) / (mid - lo) : (hi - k) / (hi - mid);
+    return (w > 0.0f) ? w : 0.0f;
+}
+
+/**
+ * @brief Precomputes the span of FFT bins [k_start, k_end) that falls into
+ * each display bucket. Must be rebuilt whenever the FFT size, sample rate or
+ * bucket ranges change.
+ * @param plan Plan to initialize
+ * @param ranges Upper frequency bound (Hz) of each bucket, ascending
+ * @param num_buckets Number of entries in ranges, at most FFT_BUCKETS
+ * @param fft_size Real FFT size in samples
+ * @param sample_rate Sample rate of the FFT input in Hz
+ * @return 0 on success, -1 on failure
+ */
+int fft_bucket_plan_init(fft_bucket_plan_t *plan, const uint16_t *ranges, int num_buckets, int fft_size, float sample_rate)
+{
+    if (plan == NULL || ranges == NULL)
+    {
+        return -1;
+    }
+    if (num_buckets <= 0 || num_buckets > FFT_BUCKETS || fft_size < 4 || sample_rate <= 0)
+    {
+        return -1;
+    }
+
+    plan->num_buckets = num_buckets;
+    plan->fft_size = fft_size;
+    for (int i = 0; i < num_buckets; i++)
+    {
+        plan->k_start[i] = 0;
+        plan->k_end[i] = 0;
+    }
+
+    // Bin k is assigned to the first bucket whose upper bound exceeds its
+    // frequency, bins above the last bound are dropped. DC is never used.
+    int bidx = 0;
+    for (int k = 1; k < fft_size / 2; k++)
+    {
+        float freq = k * sample_rate / fft_size;
+        if (freq > ranges[num_buckets - 1])
+        {
+            break;
+        }
+        while (bidx < num_buckets - 1 && freq >= ranges[bidx])
+        {
+            bidx++;
+        }
+
+        if (plan->k_end[bidx] == 0)
+        {
+            plan->k_start[bidx] = k;
+        }
+        plan->k_end[bidx] = k + 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Reduces the output of a forward real FFT to the peak magnitude of
+ * each display bucket
+ * @param plan Bucket plan matching the FFT size and sample rate
+ * @param fft_output Packed real FFT output (interleaved re/im, bin 0 holds DC/Nyquist)
+ * @param bucket_mags Output array of plan->num_buckets magnitudes
+ */
+void fft_bucket_plan_apply(const fft_bucket_plan_t *plan, const float *fft_output, float bucket_mags[])
+{
+    for (int b = 0; b < plan->num_buckets; b++)
+    {
+        // Compare squared magnitudes, only the bucket peak needs a sqrt
+        float max_sq = 0.0f;
+        const float *bin = &fft_output[2 * plan->k_start[b]];
+        for (int k = plan->k_start[b]; k < plan->k_end[b]; k++)
+        {
+            float mag_sq = bin[0] * bin[0] + bin[1] * bin[1];
+            if (mag_sq > max_sq)
+            {
+                max_sq = mag_sq;
+            }
+            bin += 2;
+        }
+        bucket_mags[b] = sqrtf(max_sq);
+    }
+}
+
+static uint32_t isqrt32(uint32_t v)
+{
+    if (v == 0)
+    {
+        return 0;
+    }
+
+    // Start at the highest power of four not above v
+    uint32_t res = 0;
+    uint32_t bit = 1u << ((31 - __builtin_clz(v)) & ~1);
+    while (bit != 0)
+    {
+        if (v >= res + bit)
+        {
+            v -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else
+        {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+/**
+ * @brief Fixed point version of fft_bucket_plan_apply()
+ * @param plan Bucket plan matching the FFT size and sample rate
+ * @param fft_output Packed output of fft_q15_execute()
+ * @param exponent Block exponent returned by fft_q15_execute()
+ * @param gain_q8 Gain applied to each magnitude in Q8, e.g. window gain correction
+ * @param bucket_mags Output array of plan->num_buckets magnitudes, saturated to UINT32_MAX
+ */
+void fft_bucket_plan_apply_q(const fft_bucket_plan_t *plan, const int16_t *fft_output, int exponent, uint32_t gain_q8, uint32_t bucket_mags[])
+{
+    for (int b = 0; b < plan->num_buckets; b++)
+    {
+        // 16 bit components, the squared magnitude fits in 32 bits
+        uint32_t max_sq = 0;
+        const int16_t *bin = &fft_output[2 * plan->k_start[b]];
+        for (int k = plan->k_start[b]; k < plan->k_end[b]; k++)
+        {
+            uint32_t mag_sq = (uint32_t)(bin[0] * bin[0]) + (uint32_t)(bin[1] * bin[1]);
+            if (mag_sq > max_sq)
+            {
+                max_sq = mag_sq;
+            }
+            bin += 2;
+        }
+
+        uint64_t mag = (uint64_t)isqrt32(max_sq) * gain_q8;
+        mag = (exponent >= 8) ? mag << (exponent - 8) : mag >> (8 - exponent);
+        bucket_mags[b] = (mag > UINT32_MAX) ? UINT32_MAX : (uint32_t)mag;
+    }
+}
+
+/**
+ * @brief Builds num_bands triangular filters evenly spaced on the mel scale
+ * between f_min and f_max. Band b rises from the center of band b - 1 and
+ * falls to the center of band b + 1, so neighbouring bands overlap and every
+ * bin between f_min and f_max contributes. Must be rebuilt whenever the FFT
+ * size or sample rate change.
+ * @param fb Filterbank to initialize
+ * @param num_bands Number of bands, at most FFT_BUCKETS
+ * @param f_min Lower edge of the first band in Hz
+ * @param f_max Upper edge of the last band in Hz, limited to the Nyquist frequency
+ * @param fft_size Real FFT size in samples
+ * @param sample_rate Sample rate of the FFT input in Hz
+ * @return 0 on success, -1 on failure
+ */
+int fft_filterbank_init(fft_filterbank_t *fb, int num_bands, float f_min, float f_max, int fft_size, float sample_rate)
+{
+    if (fb == NULL)
+    {
+        return -1;
+    }
+    if (num_bands <= 0 || num_bands > FFT_BUCKETS || fft_size < 4 || sample_rate <= 0)
+    {
+        return -1;
+    }
+    float bin_hz = sample_rate / fft_size;
+    if (f_max > sample_rate / 2 - bin_hz)
+    {
+        f_max = sample_rate / 2 - bin_hz;
+    }
+    if (f_min <= 0 || f_min >= f_max)
+    {
+        return -1;
+    }
+
+    fb->num_bands = num_bands;
+    fb->fft_size = fft_size;
+    fb->f_min = f_min;
+    fb->f_max = f_max;
+
+    float mel_min = hz_to_mel(f_min);
+    float mel_step = (hz_to_mel(f_max) - mel_min) / (num_bands + 1);
+    int offset = 0;
+    for (int b = 0; b < num_bands; b++)
+    {
+        // Band edges and center in (fractional) bins
+        float lo = mel_to_hz(mel_min + b * mel_step) / bin_hz;
+        float mid = mel_to_hz(mel_min + (b + 1) * mel_step) / bin_hz;
+        float hi = mel_to_hz(mel_min + (b + 2) * mel_step) / bin_hz;
+
+        int k_start = (int)ceilf(lo);
+        int k_end = (int)floorf(hi);
+        if (k_start < 1)
+        {
+            k_start = 1;
+        }
+        if (k_end < k_start)
+        {
+            // Narrower than a bin, use the bin nearest to the center
+            k_start = k_end = (mid < 1.0f) ? 1 : (int)lrintf(mid);
+        }
+        if (offset + k_end - k_start + 1 > FFT_FILTERBANK_MAX_WEIGHTS)
+        {
+            return -1;
+        }
+
+        float sum = 0.0f;
+        for (int k = k_start; k <= k_end; k++)
+        {
+            sum += triangle_weight(k, lo, mid, hi);
+        }
+
+        fb->k_start[b] = k_start;
+        fb->k_count[b] = k_end - k_start + 1;
+        fb->w_offset[b] = offset;
+        for (int k = k_start; k <= k_end; k++)
+        {
+            // A band that only got its nearest bin takes all of it
+            float w = (sum > 0.0f) ? triangle_weight(k, lo, mid, hi) / sum : 1.0f;
+            fb->weights[offset++] = (uint16_t)lrintf(32768.0f * w);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Reduces the output of a forward real FFT to the weighted RMS
+ * magnitude of each filterbank band
+ * @param fb Filterbank matching the FFT size and sample rate
+ * @param fft_output Packed real FFT output (interleaved re/im)
+ * @param band_mags Output array of fb->num_bands magnitudes
+ */
+void fft_filterbank_apply(const fft_filterbank_t *fb, const float *fft_output, float band_mags[])
+{
+    for (int b = 0; b < fb->num_bands; b++)
+    {
+        const float *bin = &fft_output[2 * fb->k_start[b]];
+        const uint16_t *w = &fb->weights[fb->w_offset[b]];
+        float acc = 0.0f;
+        for (int i = 0; i < fb->k_count[b]; i++)
+        {
+            acc += w[i] * (bin[0] * bin[0] + bin[1] * bin[1]);
+            bin += 2;
+        }
+        band_mags[b] = sqrtf(acc / 32768.0f);
+    }
+}
+
+/**
+ * @brief Fixed point version of fft_filterbank_apply(), scaled like
+ * fft_bucket_plan_apply_q()
+ * @param fb Filterbank matching the FFT size and sample rate
+ * @param fft_output Packed output of fft_q15_execute()
+ * @param exponent Block exponent returned by fft_q15_execute()
+ * @param gain_q8 Gain applied to each magnitude in Q8, e.g. window gain correction
+ * @param band_mags Output array of fb->num_bands magnitudes, saturated to UINT32_MAX
+ */
+void fft_filterbank_apply_q(const fft_filterbank_t *fb, const int16_t *fft_output, int exponent, uint32_t gain_q8, uint32_t band_mags[])
+{
+    for (int b = 0; b < fb->num_bands; b++)
+    {
+        const int16_t *bin = &fft_output[2 * fb->k_start[b]];
+        const uint16_t *w = &fb->weights[fb->w_offset[b]];
+        uint64_t acc = 0;
+        for (int i = 0; i < fb->k_count[b]; i++)
+        {
+            uint32_t mag_sq = (uint32_t)(bin[0] * bin[0]) + (uint32_t)(bin[1] * bin[1]);
+            acc += (uint64_t)w[i] * mag_sq;
+            bin += 2;
+        }
+
+        // Weights sum to 1.0, the weighted mean fits in 32 bits like mag_sq
+        uint64_t mag = (uint64_t)isqrt32((uint32_t)(acc >> 15)) * gain_q8;
+        mag = (exponent >= 8) ? mag << (exponent - 8) : mag >> (8 - exponent);
+        band_mags[b] = (mag > UINT32_MAX) ? UINT32_MAX : (uint32_t)mag;
+    }
+}
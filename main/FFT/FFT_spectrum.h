@@ -0,0 +1,38 @@
+#pragma once
+#include <stdint.h>
+#include "FrameBuffer.h"
+
+#define FFT_BUCKETS FRAME_BUF_COLS
+#define FFT_FILTERBANK_MAX_WEIGHTS 1024
+
+typedef struct
+{
+    int num_buckets;
+    int fft_size;
+    uint16_t k_start[FFT_BUCKETS]; // First FFT bin of each bucket
+    uint16_t k_end[FFT_BUCKETS];   // One past the last FFT bin of each bucket
+} fft_bucket_plan_t;
+
+// Triangular filters on the mel scale, stored sparse: band b weights bins
+// k_start[b] .. k_start[b] + k_count[b] - 1 with weights[w_offset[b]] onwards
+typedef struct
+{
+    int num_bands;
+    int fft_size;
+    float f_min;
+    float f_max;
+    uint16_t k_start[FFT_BUCKETS];
+    uint16_t k_count[FFT_BUCKETS];
+    uint16_t w_offset[FFT_BUCKETS];
+    uint16_t weights[FFT_FILTERBANK_MAX_WEIGHTS]; // Q15, each band sums to 1.0
+} fft_filterbank_t;
+
+extern const uint16_t fft_bucket_ranges[FFT_BUCKETS];
+
+int fft_bucket_plan_init(fft_bucket_plan_t *plan, const uint16_t *ranges, int num_buckets, int fft_size, float sample_rate);
+void fft_bucket_plan_apply(const fft_bucket_plan_t *plan, const float *fft_output, float bucket_mags[]);
+void fft_bucket_plan_apply_q(const fft_bucket_plan_t *plan, const int16_t *fft_output, int exponent, uint32_t gain_q8, uint32_t bucket_mags[]);
+
+int fft_filterbank_init(fft_filterbank_t *fb, int num_bands, float f_min, float f_max, int fft_size, float sample_rate);
+void fft_filterbank_apply(const fft_filterbank_t *fb, const float *fft_output, float band_mags[]);
+void fft_filterbank_apply_q(const fft_filterbank_t *fb, const int16_t *fft_output, int exponent, uint32_t gain_q8, uint32_t band_mags[]);
@@ -0,0 +1,285 @@
+#include "FFT_stft.h"
+
+#include <stddef.h>
+#include <math.h>
+
+#define TWO_PI 6.28318530
+
+// Function Prototypes
+static void read_frame(const fft_stft_t *stft, const int16_t *ring, uint32_t frame_end, float *frame);
+
+// Public Functions
+
+/**
+ * @brief Initializes a streaming STFT front end over caller provided buffers
+ * @param stft STFT state to initialize
+ * @param ring Sample ring of ring_size samples
+ * @param ring_size Power of two, must be at least frame_size + hop
+ * @param window Window storage of frame_size / 2 entries
+ * @param frame_size Number of samples per frame (FFT size)
+ * @param hop Number of new samples between frames
+ * @return 0 on success, -1 on failure
+ */
+int fft_stft_init(fft_stft_t *stft, int16_t *ring, uint32_t ring_size, int16_t *window, uint32_t frame_size, uint32_t hop)
+{
+    if (stft == NULL || ring == NULL || window == NULL)
+    {
+        return -1;
+    }
+    if ((ring_size & (ring_size - 1)) != 0 || frame_size < 2 || frame_size > ring_size)
+    {
+        return -1;
+    }
+
+    stft->ring = ring;
+    stft->ring_right = NULL;
+    stft->window = window;
+    stft->ring_size = ring_size;
+    stft->frame_size = frame_size;
+    stft->widx = 0;
+    stft->next_frame = frame_size;
+    atomic_init(&stft->write_limit, 0);
+    atomic_init(&stft->frame_head, 0);
+    stft->frame_tail = 0;
+    stft->dropped_frames = 0;
+    stft->late_frames = 0;
+    for (uint32_t i = 0; i < ring_size; i++)
+    {
+        ring[i] = 0;
+    }
+    fft_stft_set_window(stft, FFT_WINDOW_RECTANGULAR);
+
+    stft->hop = frame_size;
+    return fft_stft_set_hop(stft, hop);
+}
+
+/**
+ * @brief Changes the hop size, takes effect after the next completed frame
+ * @return 0 on success, -1 if the ring can't hold a frame plus one hop
+ */
+int fft_stft_set_hop(fft_stft_t *stft, uint32_t hop)
+{
+    if (hop == 0 || stft->frame_size + hop > stft->ring_size)
+    {
+        return -1;
+    }
+    stft->hop = hop;
+    return 0;
+}
+
+/**
+ * @brief Takes the oldest queued frame (consumer side), dropping frames the
+ * producer may be overwriting
+ * @param stft STFT state
+ * @param frame_end Set to the end of the frame, see fft_stft_read_frame()
+ * @return true if a frame was taken, false if the queue is empty
+ */
+bool fft_stft_next_frame(fft_stft_t *stft, uint32_t *frame_end)
+{
+    uint32_t head = atomic_load_explicit(&stft->frame_head, memory_order_acquire);
+    while (head != stft->frame_tail)
+    {
+        // The producer writes the slot of frame `head` before publishing
+        // it, so the slot of frame_tail is only safe while head - tail < depth
+        if (head - stft->frame_tail >= FFT_STFT_QUEUE_DEPTH)
+        {
+            uint32_t skip = head - stft->frame_tail - (FFT_STFT_QUEUE_DEPTH - 1);
+            stft->dropped_frames += skip;
+            stft->frame_tail += skip;
+        }
+
+        uint32_t end = stft->frames[stft->frame_tail % FFT_STFT_QUEUE_DEPTH];
+        atomic_thread_fence(memory_order_acquire);
+        head = atomic_load_explicit(&stft->frame_head, memory_order_relaxed);
+        if (head - stft->frame_tail >= FFT_STFT_QUEUE_DEPTH)
+        {
+            // Producer lapped us while reading the slot, try again
+            continue;
+        }
+
+        stft->frame_tail++;
+        *frame_end = end;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Checks, after reading a frame, that the producer didn't overwrite
+ * any of its samples in the meantime. Counts the frame as late if it did.
+ * @return true if the samples read are intact
+ */
+bool fft_stft_frame_intact(fft_stft_t *stft, uint32_t frame_end)
+{
+    // Order the ring reads before the write_limit load
+    atomic_thread_fence(memory_order_acquire);
+    uint32_t limit = atomic_load_explicit(&stft->write_limit, memory_order_relaxed);
+    if (limit - (frame_end - stft->frame_size) > stft->ring_size)
+    {
+        stft->late_frames++;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Adds a right channel ring for fft_stft_push_stereo() and the stereo
+ * reads, or removes it with NULL. Call before the producer starts.
+ * @param ring_right ring_size samples
+ * @return 0 on success, -1 on failure
+ */
+int fft_stft_set_right_ring(fft_stft_t *stft, int16_t *ring_right)
+{
+    if (stft == NULL)
+    {
+        return -1;
+    }
+    if (ring_right != NULL)
+    {
+        for (uint32_t i = 0; i < stft->ring_size; i++)
+        {
+            ring_right[i] = 0;
+        }
+    }
+    stft->ring_right = ring_right;
+    return 0;
+}
+
+/**
+ * @brief Precomputes the analysis window in Q15. The gain needed to bring it
+ * to unity coherent gain is kept separately so windowed frames can't
+ * overflow 16 bits, and bucket magnitudes stay comparable to an unwindowed
+ * frame once it's applied.
+ */
+void fft_stft_set_window(fft_stft_t *stft, fft_window_type_t type)
+{
+    uint32_t n = stft->frame_size;
+    double sum = 0.0;
+    for (uint32_t i = 0; i < n / 2; i++)
+    {
+        double phase = TWO_PI * i / (n - 1);
+        double w;
+        switch (type)
+        {
+        case FFT_WINDOW_HANN:
+            w = 0.5 - 0.5 * cos(phase);
+            break;
+        case FFT_WINDOW_BLACKMAN:
+            w = 0.42 - 0.5 * cos(phase) + 0.08 * cos(2 * phase);
+            break;
+        case FFT_WINDOW_RECTANGULAR:
+        default:
+            w = 1.0;
+            break;
+        }
+        stft->window[i] = (int16_t)lrint(w * 32767.0);
+        sum += 2 * w;
+    }
+    stft->window_gain_q8 = (uint16_t)lrint(256.0 * n / sum);
+}
+
+/**
+ * @brief Copies the frame ending at frame_end out of the ring, applying the
+ * window and its gain correction
+ * @param stft STFT state
+ * @param frame_end Sample count at the end of the frame, from fft_stft_next_frame()
+ * @param frame Output buffer of frame_size floats
+ */
+void fft_stft_read_frame(const fft_stft_t *stft, uint32_t frame_end, float *frame)
+{
+    read_frame(stft, stft->ring, frame_end, frame);
+}
+
+/**
+ * @brief fft_stft_read_frame() for the right channel ring
+ */
+void fft_stft_read_frame_right(const fft_stft_t *stft, uint32_t frame_end, float *frame)
+{
+    read_frame(stft, stft->ring_right, frame_end, frame);
+}
+
+/**
+ * @brief Fixed point version of fft_stft_read_frame(), the window gain
+ * correction is left to the caller (see window_gain_q8)
+ * @param frame Output buffer of frame_size Q15 samples
+ */
+void fft_stft_read_frame_q15(const fft_stft_t *stft, uint32_t frame_end, int16_t *frame)
+{
+    uint32_t mask = stft->ring_size - 1;
+    uint32_t n = stft->frame_size;
+    uint32_t start = frame_end - n;
+    const int16_t *ring = stft->ring;
+    const int16_t *window = stft->window;
+
+    for (uint32_t i = 0; i < n / 2; i++)
+    {
+        frame[i] = (int16_t)((ring[(start + i) & mask] * window[i] + (1 << 14)) >> 15);
+    }
+    for (uint32_t i = n / 2; i < n; i++)
+    {
+        frame[i] = (int16_t)((ring[(start + i) & mask] * window[n - 1 - i] + (1 << 14)) >> 15);
+    }
+}
+
+/**
+ * @brief Stereo version of fft_stft_read_frame_q15(), the left and right
+ * frames are interleaved (left first) as fft_q15_execute_stereo() takes them
+ * @param frame Output buffer of 2 * frame_size Q15 samples
+ */
+void fft_stft_read_frame_stereo_q15(const fft_stft_t *stft, uint32_t frame_end, int16_t *frame)
+{
+    uint32_t mask = stft->ring_size - 1;
+    uint32_t n = stft->frame_size;
+    uint32_t start = frame_end - n;
+    const int16_t *left = stft->ring;
+    const int16_t *right = stft->ring_right;
+    const int16_t *window = stft->window;
+
+    for (uint32_t i = 0; i < n / 2; i++)
+    {
+        uint32_t j = (start + i) & mask;
+        frame[2 * i] = (int16_t)((left[j] * window[i] + (1 << 14)) >> 15);
+        frame[2 * i + 1] = (int16_t)((right[j] * window[i] + (1 << 14)) >> 15);
+    }
+    for (uint32_t i = n / 2; i < n; i++)
+    {
+        uint32_t j = (start + i) & mask;
+        frame[2 * i] = (int16_t)((left[j] * window[n - 1 - i] + (1 << 14)) >> 15);
+        frame[2 * i + 1] = (int16_t)((right[j] * window[n - 1 - i] + (1 << 14)) >> 15);
+    }
+}
+
+/**
+ * @brief Copies the count samples that end at frame_end out of the ring,
+ * without windowing. Check fft_stft_frame_intact() afterwards like for a frame.
+ * @param samples Output buffer of count samples, count at most frame_size
+ */
+void fft_stft_read_samples(const fft_stft_t *stft, uint32_t frame_end, int16_t *samples, uint32_t count)
+{
+    uint32_t mask = stft->ring_size - 1;
+    uint32_t start = frame_end - count;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        samples[i] = stft->ring[(start + i) & mask];
+    }
+}
+
+// Private Functions
+static void read_frame(const fft_stft_t *stft, const int16_t *ring, uint32_t frame_end, float *frame)
+{
+    uint32_t mask = stft->ring_size - 1;
+    uint32_t n = stft->frame_size;
+    uint32_t start = frame_end - n;
+    const int16_t *window = stft->window;
+    float scale = stft->window_gain_q8 / (256.0f * 32767.0f);
+
+    // Window is symmetric, walk the stored half forwards then backwards
+    for (uint32_t i = 0; i < n / 2; i++)
+    {
+        frame[i] = (float)(ring[(start + i) & mask] * window[i]) * scale;
+    }
+    for (uint32_t i = n / 2; i < n; i++)
+    {
+        frame[i] = (float)(ring[(start + i) & mask] * window[n - 1 - i]) * scale;
+    }
+}
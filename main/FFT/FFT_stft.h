@@ -0,0 +1,98 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+typedef enum
+{
+    FFT_WINDOW_RECTANGULAR,
+    FFT_WINDOW_HANN,
+    FFT_WINDOW_BLACKMAN,
+} fft_window_type_t;
+
+// Completed frames the producer can run ahead of the consumer
+#define FFT_STFT_QUEUE_DEPTH 4
+
+/*
+ * Single producer (the A2DP data callback) / single consumer (the FFT task).
+ * The producer only writes the ring, widx, write_limit and the frame queue
+ * head, the consumer only the queue tail and the counters. Nothing blocks:
+ * a full queue drops the oldest frame, and a frame whose samples were
+ * overwritten while it was being read is discarded as late.
+ */
+typedef struct
+{
+    int16_t *ring;                // Input samples, ring_size entries (left channel in stereo)
+    int16_t *ring_right;          // Optional right channel, same positions as ring, see fft_stft_push_stereo()
+    int16_t *window;              // First half of the (symmetric) window in Q15, frame_size / 2 entries
+    uint16_t window_gain_q8;      // Coherent gain correction of the window in Q8 (256 = 1.0)
+    uint32_t ring_size;           // Power of two, at least frame_size + hop
+    uint32_t frame_size;          // FFT size
+    volatile uint32_t hop;        // Samples between successive frames
+
+    // Producer
+    uint32_t widx;                         // Free running count of samples written
+    uint32_t next_frame;                   // Value of widx at which the next frame is complete
+    atomic_uint_least32_t write_limit;     // Ring positions below this may be (being) written
+    uint32_t frames[FFT_STFT_QUEUE_DEPTH]; // widx at the end of each queued frame
+    atomic_uint_least32_t frame_head;      // Free running count of frames queued
+
+    // Consumer
+    uint32_t frame_tail;          // Free running count of frames taken
+    uint32_t dropped_frames;      // Frames lost to a full queue
+    uint32_t late_frames;         // Frames overwritten before they could be read
+} fft_stft_t;
+
+int fft_stft_init(fft_stft_t *stft, int16_t *ring, uint32_t ring_size, int16_t *window, uint32_t frame_size, uint32_t hop);
+int fft_stft_set_hop(fft_stft_t *stft, uint32_t hop);
+void fft_stft_set_window(fft_stft_t *stft, fft_window_type_t type);
+int fft_stft_set_right_ring(fft_stft_t *stft, int16_t *ring_right);
+bool fft_stft_next_frame(fft_stft_t *stft, uint32_t *frame_end);
+bool fft_stft_frame_intact(fft_stft_t *stft, uint32_t frame_end);
+void fft_stft_read_frame(const fft_stft_t *stft, uint32_t frame_end, float *frame);
+void fft_stft_read_frame_q15(const fft_stft_t *stft, uint32_t frame_end, int16_t *frame);
+void fft_stft_read_frame_right(const fft_stft_t *stft, uint32_t frame_end, float *frame);
+void fft_stft_read_frame_stereo_q15(const fft_stft_t *stft, uint32_t frame_end, int16_t *frame);
+void fft_stft_read_samples(const fft_stft_t *stft, uint32_t frame_end, int16_t *samples, uint32_t count);
+
+/**
+ * @brief Announces that the producer is about to push count samples, must
+ * precede every batch of fft_stft_push() calls
+ */
+static inline void fft_stft_begin_write(fft_stft_t *stft, uint32_t count)
+{
+    atomic_store_explicit(&stft->write_limit, stft->widx + count, memory_order_relaxed);
+    // The new limit has to be visible before any of the ring writes
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+/**
+ * @brief Appends one sample to the ring (producer side)
+ * @return true if a new frame was queued with this sample
+ */
+static inline bool fft_stft_push(fft_stft_t *stft, int16_t sample)
+{
+    stft->ring[stft->widx & (stft->ring_size - 1)] = sample;
+    stft->widx++;
+    if ((int32_t)(stft->widx - stft->next_frame) >= 0)
+    {
+        uint32_t head = atomic_load_explicit(&stft->frame_head, memory_order_relaxed);
+        stft->next_frame = stft->widx + stft->hop;
+        stft->frames[head % FFT_STFT_QUEUE_DEPTH] = stft->widx;
+        atomic_store_explicit(&stft->frame_head, head + 1, memory_order_release);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Appends one left/right sample pair (producer side). Both channels
+ * share the write position and the frame queue, one fft_stft_begin_write()
+ * covers count pairs.
+ * @return true if a new frame was queued with this pair
+ */
+static inline bool fft_stft_push_stereo(fft_stft_t *stft, int16_t left, int16_t right)
+{
+    stft->ring_right[stft->widx & (stft->ring_size - 1)] = right;
+    return fft_stft_push(stft, left);
+}
@@ -0,0 +1,1165 @@
+// Generated by Scripts/gen_fft_tables.py, do not edit
+#include "FFT_tables.h"
+
+const float fft_radix4_real_twiddles_1024[1532] = {
+    1.0f, 0.0f, 0.999981165f, 0.00613588467f, 0.999924719f, 0.0122715384f, 0.999830604f, 0.0184067301f,
+    0.999698818f, 0.024541229f, 0.999529421f, 0.030674804f, 0.999322355f, 0.0368072242f, 0.999077737f, 0.0429382585f,
+    0.99879545f, 0.0490676761f, 0.998475552f, 0.0551952459f, 0.998118103f, 0.061320737f, 0.997723043f, 0.0674439222f,
+    0.997290432f, 0.0735645667f, 0.996820271f, 0.0796824396f, 0.996312618f, 0.0857973099f, 0.995767415f, 0.0919089541f,
+    0.99518472f, 0.0980171412f, 0.994564593f, 0.104121633f, 0.993906975f, 0.110222206f, 0.993211925f, 0.116318628f,
+    0.992479563f, 0.122410677f, 0.991709769f, 0.128498107f, 0.990902662f, 0.134580702f, 0.990058184f, 0.140658244f,
+    0.989176512f, 0.146730468f, 0.988257587f, 0.152797192f, 0.987301409f, 0.15885815f, 0.986308098f, 0.164913118f,
+    0.985277653f, 0.170961887f, 0.984210074f, 0.177004218f, 0.983105481f, 0.183039889f, 0.981963873f, 0.18906866f,
+    0.980785251f, 0.195090324f, 0.979569793f, 0.201104641f, 0.97831738f, 0.207111374f, 0.977028131f, 0.213110313f,
+    0.975702107f, 0.219101235f, 0.974339366f, 0.225083917f, 0.972939968f, 0.231058106f, 0.971503913f, 0.237023607f,
+    0.970031261f, 0.242980182f, 0.968522072f, 0.248927608f, 0.966976464f, 0.254865646f, 0.965394437f, 0.260794103f,
+    0.963776052f, 0.266712755f, 0.962121427f, 0.272621363f, 0.960430503f, 0.27851969f, 0.958703458f, 0.284407526f,
+    0.956940353f, 0.290284663f, 0.955141187f, 0.296150893f, 0.953306019f, 0.302005947f, 0.95143503f, 0.307849646f,
+    0.949528158f, 0.313681751f, 0.947585583f, 0.319502026f, 0.945607305f, 0.32531029f, 0.943593442f, 0.331106305f,
+    0.941544056f, 0.336889863f, 0.939459205f, 0.342660725f, 0.937339008f, 0.348418683f, 0.935183525f, 0.354163527f,
+    0.932992816f, 0.359895051f, 0.93076694f, 0.365612984f, 0.928506076f, 0.371317208f, 0.926210225f, 0.377007425f,
+    0.923879504f, 0.382683426f, 0.921514034f, 0.388345033f, 0.919113874f, 0.393992037f, 0.916679084f, 0.399624199f,
+    0.914209783f, 0.405241311f, 0.91170603f, 0.410843164f, 0.909168005f, 0.416429549f, 0.906595707f, 0.422000259f,
+    0.903989315f, 0.427555084f, 0.901348829f, 0.433093816f, 0.898674488f, 0.438616246f, 0.895966232f, 0.444122136f,
+    0.893224299f, 0.449611336f, 0.890448749f, 0.455083579f, 0.887639642f, 0.460538715f, 0.884797096f, 0.465976506f,
+    0.881921291f, 0.471396744f, 0.879012227f, 0.47679922f, 0.876070082f, 0.482183784f, 0.873094976f, 0.487550169f,
+    0.870086968f, 0.492898196f, 0.867046237f, 0.498227656f, 0.863972843f, 0.50353837f, 0.860866964f, 0.50883013f,
+    0.857728601f, 0.514102757f, 0.854557991f, 0.519356012f, 0.851355195f, 0.524589658f, 0.848120332f, 0.529803634f,
+    0.84485358f, 0.534997642f, 0.841554999f, 0.540171444f, 0.838224709f, 0.545324981f, 0.834862888f, 0.550457954f,
+    0.831469595f, 0.555570245f, 0.82804507f, 0.560661554f, 0.824589312f, 0.565731823f, 0.8211025f, 0.570780754f,
+    0.817584813f, 0.575808167f, 0.81403631f, 0.580813944f, 0.81045717f, 0.585797846f, 0.806847572f, 0.590759695f,
+    0.803207517f, 0.59569931f, 0.799537241f, 0.600616455f, 0.795836926f, 0.605511069f, 0.792106569f, 0.610382795f,
+    0.78834641f, 0.615231574f, 0.784556568f, 0.620057225f, 0.780737221f, 0.624859512f, 0.77688849f, 0.629638255f,
+    0.773010433f, 0.634393275f, 0.769103348f, 0.639124453f, 0.765167236f, 0.643831551f, 0.761202395f, 0.64851439f,
+    0.757208824f, 0.653172851f, 0.753186822f, 0.657806695f, 0.749136388f, 0.662415802f, 0.745057762f, 0.666999936f,
+    0.740951121f, 0.671558976f, 0.736816585f, 0.676092684f, 0.732654274f, 0.680601001f, 0.728464365f, 0.685083687f,
+    0.724247098f, 0.689540565f, 0.720002532f, 0.693971455f, 0.715730846f, 0.698376238f, 0.711432219f, 0.702754736f,
+    0.707106769f, 0.707106769f, 0.702754736f, 0.711432219f, 0.698376238f, 0.715730846f, 0.693971455f, 0.720002532f,
+    0.689540565f, 0.724247098f, 0.685083687f, 0.728464365f, 0.680601001f, 0.732654274f, 0.676092684f, 0.736816585f,
+    0.671558976f, 0.740951121f, 0.666999936f, 0.745057762f, 0.662415802f, 0.749136388f, 0.657806695f, 0.753186822f,
+    0.653172851f, 0.757208824f, 0.64851439f, 0.761202395f, 0.643831551f, 0.765167236f, 0.639124453f, 0.769103348f,
+    0.634393275f, 0.773010433f, 0.629638255f, 0.77688849f, 0.624859512f, 0.780737221f, 0.620057225f, 0.784556568f,
+    0.615231574f, 0.78834641f, 0.610382795f, 0.792106569f, 0.605511069f, 0.795836926f, 0.600616455f, 0.799537241f,
+    0.59569931f, 0.803207517f, 0.590759695f, 0.806847572f, 0.585797846f, 0.81045717f, 0.580813944f, 0.81403631f,
+    0.575808167f, 0.817584813f, 0.570780754f, 0.8211025f, 0.565731823f, 0.824589312f, 0.560661554f, 0.82804507f,
+    0.555570245f, 0.831469595f, 0.550457954f, 0.834862888f, 0.545324981f, 0.838224709f, 0.540171444f, 0.841554999f,
+    0.534997642f, 0.84485358f, 0.529803634f, 0.848120332f, 0.524589658f, 0.851355195f, 0.519356012f, 0.854557991f,
+    0.514102757f, 0.857728601f, 0.50883013f, 0.860866964f, 0.50353837f, 0.863972843f, 0.498227656f, 0.867046237f,
+    0.492898196f, 0.870086968f, 0.487550169f, 0.873094976f, 0.482183784f, 0.876070082f, 0.47679922f, 0.879012227f,
+    0.471396744f, 0.881921291f, 0.465976506f, 0.884797096f, 0.460538715f, 0.887639642f, 0.455083579f, 0.890448749f,
+    0.449611336f, 0.893224299f, 0.444122136f, 0.895966232f, 0.438616246f, 0.898674488f, 0.433093816f, 0.901348829f,
+    0.427555084f, 0.903989315f, 0.422000259f, 0.906595707f, 0.416429549f, 0.909168005f, 0.410843164f, 0.91170603f,
+    0.405241311f, 0.914209783f, 0.399624199f, 0.916679084f, 0.393992037f, 0.919113874f, 0.388345033f, 0.921514034f,
+    0.382683426f, 0.923879504f, 0.377007425f, 0.926210225f, 0.371317208f, 0.928506076f, 0.365612984f, 0.93076694f,
+    0.359895051f, 0.932992816f, 0.354163527f, 0.935183525f, 0.348418683f, 0.937339008f, 0.342660725f, 0.939459205f,
+    0.336889863f, 0.941544056f, 0.331106305f, 0.943593442f, 0.32531029f, 0.945607305f, 0.319502026f, 0.947585583f,
+    0.313681751f, 0.949528158f, 0.307849646f, 0.95143503f, 0.302005947f, 0.953306019f, 0.296150893f, 0.955141187f,
+    0.290284663f, 0.956940353f, 0.284407526f, 0.958703458f, 0.27851969f, 0.960430503f, 0.272621363f, 0.962121427f,
+    0.266712755f, 0.963776052f, 0.260794103f, 0.965394437f, 0.254865646f, 0.966976464f, 0.248927608f, 0.968522072f,
+    0.242980182f, 0.970031261f, 0.237023607f, 0.971503913f, 0.231058106f, 0.972939968f, 0.225083917f, 0.974339366f,
+    0.219101235f, 0.975702107f, 0.213110313f, 0.977028131f, 0.207111374f, 0.97831738f, 0.201104641f, 0.979569793f,
+    0.195090324f, 0.980785251f, 0.18906866f, 0.981963873f, 0.183039889f, 0.983105481f, 0.177004218f, 0.984210074f,
+    0.170961887f, 0.985277653f, 0.164913118f, 0.986308098f, 0.15885815f, 0.987301409f, 0.152797192f, 0.988257587f,
+    0.146730468f, 0.989176512f, 0.140658244f, 0.990058184f, 0.134580702f, 0.990902662f, 0.128498107f, 0.991709769f,
+    0.122410677f, 0.992479563f, 0.116318628f, 0.993211925f, 0.110222206f, 0.993906975f, 0.104121633f, 0.994564593f,
+    0.0980171412f, 0.99518472f, 0.0919089541f, 0.995767415f, 0.0857973099f, 0.996312618f, 0.0796824396f, 0.996820271f,
+    0.0735645667f, 0.997290432f, 0.0674439222f, 0.997723043f, 0.061320737f, 0.998118103f, 0.0551952459f, 0.998475552f,
+    0.0490676761f, 0.99879545f, 0.0429382585f, 0.999077737f, 0.0368072242f, 0.999322355f, 0.030674804f, 0.999529421f,
+    0.024541229f, 0.999698818f, 0.0184067301f, 0.999830604f, 0.0122715384f, 0.999924719f, 0.00613588467f, 0.999981165f,
+    1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.707106769f, 0.707106769f,
+    6.12323426e-17f, 1.0f, -0.707106769f, 0.707106769f, 1.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.980785251f, 0.195090324f, 0.923879504f, 0.382683426f, 0.831469595f, 0.555570245f,
+    0.923879504f, 0.382683426f, 0.707106769f, 0.707106769f, 0.382683426f, 0.923879504f, 0.831469595f, 0.555570245f,
+    0.382683426f, 0.923879504f, -0.195090324f, 0.980785251f, 0.707106769f, 0.707106769f, 6.12323426e-17f, 1.0f,
+    -0.707106769f, 0.707106769f, 0.555570245f, 0.831469595f, -0.382683426f, 0.923879504f, -0.980785251f, 0.195090324f,
+    0.382683426f, 0.923879504f, -0.707106769f, 0.707106769f, -0.923879504f, -0.382683426f, 0.195090324f, 0.980785251f,
+    -0.923879504f, 0.382683426f, -0.555570245f, -0.831469595f, 1.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.99879545f, 0.0490676761f, 0.99518472f, 0.0980171412f, 0.989176512f, 0.146730468f,
+    0.99518472f, 0.0980171412f, 0.980785251f, 0.195090324f, 0.956940353f, 0.290284663f, 0.989176512f, 0.146730468f,
+    0.956940353f, 0.290284663f, 0.903989315f, 0.427555084f, 0.980785251f, 0.195090324f, 0.923879504f, 0.382683426f,
+    0.831469595f, 0.555570245f, 0.970031261f, 0.242980182f, 0.881921291f, 0.471396744f, 0.740951121f, 0.671558976f,
+    0.956940353f, 0.290284663f, 0.831469595f, 0.555570245f, 0.634393275f, 0.773010433f, 0.941544056f, 0.336889863f,
+    0.773010433f, 0.634393275f, 0.514102757f, 0.857728601f, 0.923879504f, 0.382683426f, 0.707106769f, 0.707106769f,
+    0.382683426f, 0.923879504f, 0.903989315f, 0.427555084f, 0.634393275f, 0.773010433f, 0.242980182f, 0.970031261f,
+    0.881921291f, 0.471396744f, 0.555570245f, 0.831469595f, 0.0980171412f, 0.99518472f, 0.857728601f, 0.514102757f,
+    0.471396744f, 0.881921291f, -0.0490676761f, 0.99879545f, 0.831469595f, 0.555570245f, 0.382683426f, 0.923879504f,
+    -0.195090324f, 0.980785251f, 0.803207517f, 0.59569931f, 0.290284663f, 0.956940353f, -0.336889863f, 0.941544056f,
+    0.773010433f, 0.634393275f, 0.195090324f, 0.980785251f, -0.471396744f, 0.881921291f, 0.740951121f, 0.671558976f,
+    0.0980171412f, 0.99518472f, -0.59569931f, 0.803207517f, 0.707106769f, 0.707106769f, 6.12323426e-17f, 1.0f,
+    -0.707106769f, 0.707106769f, 0.671558976f, 0.740951121f, -0.0980171412f, 0.99518472f, -0.803207517f, 0.59569931f,
+    0.634393275f, 0.773010433f, -0.195090324f, 0.980785251f, -0.881921291f, 0.471396744f, 0.59569931f, 0.803207517f,
+    -0.290284663f, 0.956940353f, -0.941544056f, 0.336889863f, 0.555570245f, 0.831469595f, -0.382683426f, 0.923879504f,
+    -0.980785251f, 0.195090324f, 0.514102757f, 0.857728601f, -0.471396744f, 0.881921291f, -0.99879545f, 0.0490676761f,
+    0.471396744f, 0.881921291f, -0.555570245f, 0.831469595f, -0.99518472f, -0.0980171412f, 0.427555084f, 0.903989315f,
+    -0.634393275f, 0.773010433f, -0.970031261f, -0.242980182f, 0.382683426f, 0.923879504f, -0.707106769f, 0.707106769f,
+    -0.923879504f, -0.382683426f, 0.336889863f, 0.941544056f, -0.773010433f, 0.634393275f, -0.857728601f, -0.514102757f,
+    0.290284663f, 0.956940353f, -0.831469595f, 0.555570245f, -0.773010433f, -0.634393275f, 0.242980182f, 0.970031261f,
+    -0.881921291f, 0.471396744f, -0.671558976f, -0.740951121f, 0.195090324f, 0.980785251f, -0.923879504f, 0.382683426f,
+    -0.555570245f, -0.831469595f, 0.146730468f, 0.989176512f, -0.956940353f, 0.290284663f, -0.427555084f, -0.903989315f,
+    0.0980171412f, 0.99518472f, -0.980785251f, 0.195090324f, -0.290284663f, -0.956940353f, 0.0490676761f, 0.99879545f,
+    -0.99518472f, 0.0980171412f, -0.146730468f, -0.989176512f, 1.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.999924719f, 0.0122715384f, 0.999698818f, 0.024541229f, 0.999322355f, 0.0368072242f,
+    0.999698818f, 0.024541229f, 0.99879545f, 0.0490676761f, 0.997290432f, 0.0735645667f, 0.999322355f, 0.0368072242f,
+    0.997290432f, 0.0735645667f, 0.993906975f, 0.110222206f, 0.99879545f, 0.0490676761f, 0.99518472f, 0.0980171412f,
+    0.989176512f, 0.146730468f, 0.998118103f, 0.061320737f, 0.992479563f, 0.122410677f, 0.983105481f, 0.183039889f,
+    0.997290432f, 0.0735645667f, 0.989176512f, 0.146730468f, 0.975702107f, 0.219101235f, 0.996312618f, 0.0857973099f,
+    0.985277653f, 0.170961887f, 0.966976464f, 0.254865646f, 0.99518472f, 0.0980171412f, 0.980785251f, 0.195090324f,
+    0.956940353f, 0.290284663f, 0.993906975f, 0.110222206f, 0.975702107f, 0.219101235f, 0.945607305f, 0.32531029f,
+    0.992479563f, 0.122410677f, 0.970031261f, 0.242980182f, 0.932992816f, 0.359895051f, 0.990902662f, 0.134580702f,
+    0.963776052f, 0.266712755f, 0.919113874f, 0.393992037f, 0.989176512f, 0.146730468f, 0.956940353f, 0.290284663f,
+    0.903989315f, 0.427555084f, 0.987301409f, 0.15885815f, 0.949528158f, 0.313681751f, 0.887639642f, 0.460538715f,
+    0.985277653f, 0.170961887f, 0.941544056f, 0.336889863f, 0.870086968f, 0.492898196f, 0.983105481f, 0.183039889f,
+    0.932992816f, 0.359895051f, 0.851355195f, 0.524589658f, 0.980785251f, 0.195090324f, 0.923879504f, 0.382683426f,
+    0.831469595f, 0.555570245f, 0.97831738f, 0.207111374f, 0.914209783f, 0.405241311f, 0.81045717f, 0.585797846f,
+    0.975702107f, 0.219101235f, 0.903989315f, 0.427555084f, 0.78834641f, 0.615231574f, 0.972939968f, 0.231058106f,
+    0.893224299f, 0.449611336f, 0.765167236f, 0.643831551f, 0.970031261f, 0.242980182f, 0.881921291f, 0.471396744f,
+    0.740951121f, 0.671558976f, 0.966976464f, 0.254865646f, 0.870086968f, 0.492898196f, 0.715730846f, 0.698376238f,
+    0.963776052f, 0.266712755f, 0.857728601f, 0.514102757f, 0.689540565f, 0.724247098f, 0.960430503f, 0.27851969f,
+    0.84485358f, 0.534997642f, 0.662415802f, 0.749136388f, 0.956940353f, 0.290284663f, 0.831469595f, 0.555570245f,
+    0.634393275f, 0.773010433f, 0.953306019f, 0.302005947f, 0.817584813f, 0.575808167f, 0.605511069f, 0.795836926f,
+    0.949528158f, 0.313681751f, 0.803207517f, 0.59569931f, 0.575808167f, 0.817584813f, 0.945607305f, 0.32531029f,
+    0.78834641f, 0.615231574f, 0.545324981f, 0.838224709f, 0.941544056f, 0.336889863f, 0.773010433f, 0.634393275f,
+    0.514102757f, 0.857728601f, 0.937339008f, 0.348418683f, 0.757208824f, 0.653172851f, 0.482183784f, 0.876070082f,
+    0.932992816f, 0.359895051f, 0.740951121f, 0.671558976f, 0.449611336f, 0.893224299f, 0.928506076f, 0.371317208f,
+    0.724247098f, 0.689540565f, 0.416429549f, 0.909168005f, 0.923879504f, 0.382683426f, 0.707106769f, 0.707106769f,
+    0.382683426f, 0.923879504f, 0.919113874f, 0.393992037f, 0.689540565f, 0.724247098f, 0.348418683f, 0.937339008f,
+    0.914209783f, 0.405241311f, 0.671558976f, 0.740951121f, 0.313681751f, 0.949528158f, 0.909168005f, 0.416429549f,
+    0.653172851f, 0.757208824f, 0.27851969f, 0.960430503f, 0.903989315f, 0.427555084f, 0.634393275f, 0.773010433f,
+    0.242980182f, 0.970031261f, 0.898674488f, 0.438616246f, 0.615231574f, 0.78834641f, 0.207111374f, 0.97831738f,
+    0.893224299f, 0.449611336f, 0.59569931f, 0.803207517f, 0.170961887f, 0.985277653f, 0.887639642f, 0.460538715f,
+    0.575808167f, 0.817584813f, 0.134580702f, 0.990902662f, 0.881921291f, 0.471396744f, 0.555570245f, 0.831469595f,
+    0.0980171412f, 0.99518472f, 0.876070082f, 0.482183784f, 0.534997642f, 0.84485358f, 0.061320737f, 0.998118103f,
+    0.870086968f, 0.492898196f, 0.514102757f, 0.857728601f, 0.024541229f, 0.999698818f, 0.863972843f, 0.50353837f,
+    0.492898196f, 0.870086968f, -0.0122715384f, 0.999924719f, 0.857728601f, 0.514102757f, 0.471396744f, 0.881921291f,
+    -0.0490676761f, 0.99879545f, 0.851355195f, 0.524589658f, 0.449611336f, 0.893224299f, -0.0857973099f, 0.996312618f,
+    0.84485358f, 0.534997642f, 0.427555084f, 0.903989315f, -0.122410677f, 0.992479563f, 0.838224709f, 0.545324981f,
+    0.405241311f, 0.914209783f, -0.15885815f, 0.987301409f, 0.831469595f, 0.555570245f, 0.382683426f, 0.923879504f,
+    -0.195090324f, 0.980785251f, 0.824589312f, 0.565731823f, 0.359895051f, 0.932992816f, -0.231058106f, 0.972939968f,
+    0.817584813f, 0.575808167f, 0.336889863f, 0.941544056f, -0.266712755f, 0.963776052f, 0.81045717f, 0.585797846f,
+    0.313681751f, 0.949528158f, -0.302005947f, 0.953306019f, 0.803207517f, 0.59569931f, 0.290284663f, 0.956940353f,
+    -0.336889863f, 0.941544056f, 0.795836926f, 0.605511069f, 0.266712755f, 0.963776052f, -0.371317208f, 0.928506076f,
+    0.78834641f, 0.615231574f, 0.242980182f, 0.970031261f, -0.405241311f, 0.914209783f, 0.780737221f, 0.624859512f,
+    0.219101235f, 0.975702107f, -0.438616246f, 0.898674488f, 0.773010433f, 0.634393275f, 0.195090324f, 0.980785251f,
+    -0.471396744f, 0.881921291f, 0.765167236f, 0.643831551f, 0.170961887f, 0.985277653f, -0.50353837f, 0.863972843f,
+    0.757208824f, 0.653172851f, 0.146730468f, 0.989176512f, -0.534997642f, 0.84485358f, 0.749136388f, 0.662415802f,
+    0.122410677f, 0.992479563f, -0.565731823f, 0.824589312f, 0.740951121f, 0.671558976f, 0.0980171412f, 0.99518472f,
+    -0.59569931f, 0.803207517f, 0.732654274f, 0.680601001f, 0.0735645667f, 0.997290432f, -0.624859512f, 0.780737221f,
+    0.724247098f, 0.689540565f, 0.0490676761f, 0.99879545f, -0.653172851f, 0.757208824f, 0.715730846f, 0.698376238f,
+    0.024541229f, 0.999698818f, -0.680601001f, 0.732654274f, 0.707106769f, 0.707106769f, 6.12323426e-17f, 1.0f,
+    -0.707106769f, 0.707106769f, 0.698376238f, 0.715730846f, -0.024541229f, 0.999698818f, -0.732654274f, 0.680601001f,
+    0.689540565f, 0.724247098f, -0.0490676761f, 0.99879545f, -0.757208824f, 0.653172851f, 0.680601001f, 0.732654274f,
+    -0.0735645667f, 0.997290432f, -0.780737221f, 0.624859512f, 0.671558976f, 0.740951121f, -0.0980171412f, 0.99518472f,
+    -0.803207517f, 0.59569931f, 0.662415802f, 0.749136388f, -0.122410677f, 0.992479563f, -0.824589312f, 0.565731823f,
+    0.653172851f, 0.757208824f, -0.146730468f, 0.989176512f, -0.84485358f, 0.534997642f, 0.643831551f, 0.765167236f,
+    -0.170961887f, 0.985277653f, -0.863972843f, 0.50353837f, 0.634393275f, 0.773010433f, -0.195090324f, 0.980785251f,
+    -0.881921291f, 0.471396744f, 0.624859512f, 0.780737221f, -0.219101235f, 0.975702107f, -0.898674488f, 0.438616246f,
+    0.615231574f, 0.78834641f, -0.242980182f, 0.970031261f, -0.914209783f, 0.405241311f, 0.605511069f, 0.795836926f,
+    -0.266712755f, 0.963776052f, -0.928506076f, 0.371317208f, 0.59569931f, 0.803207517f, -0.290284663f, 0.956940353f,
+    -0.941544056f, 0.336889863f, 0.585797846f, 0.81045717f, -0.313681751f, 0.949528158f, -0.953306019f, 0.302005947f,
+    0.575808167f, 0.817584813f, -0.336889863f, 0.941544056f, -0.963776052f, 0.266712755f, 0.565731823f, 0.824589312f,
+    -0.359895051f, 0.932992816f, -0.972939968f, 0.231058106f, 0.555570245f, 0.831469595f, -0.382683426f, 0.923879504f,
+    -0.980785251f, 0.195090324f, 0.545324981f, 0.838224709f, -0.405241311f, 0.914209783f, -0.987301409f, 0.15885815f,
+    0.534997642f, 0.84485358f, -0.427555084f, 0.903989315f, -0.992479563f, 0.122410677f, 0.524589658f, 0.851355195f,
+    -0.449611336f, 0.893224299f, -0.996312618f, 0.0857973099f, 0.514102757f, 0.857728601f, -0.471396744f, 0.881921291f,
+    -0.99879545f, 0.0490676761f, 0.50353837f, 0.863972843f, -0.492898196f, 0.870086968f, -0.999924719f, 0.0122715384f,
+    0.492898196f, 0.870086968f, -0.514102757f, 0.857728601f, -0.999698818f, -0.024541229f, 0.482183784f, 0.876070082f,
+    -0.534997642f, 0.84485358f, -0.998118103f, -0.061320737f, 0.471396744f, 0.881921291f, -0.555570245f, 0.831469595f,
+    -0.99518472f, -0.0980171412f, 0.460538715f, 0.887639642f, -0.575808167f, 0.817584813f, -0.990902662f, -0.134580702f,
+    0.449611336f, 0.893224299f, -0.59569931f, 0.803207517f, -0.985277653f, -0.170961887f, 0.438616246f, 0.898674488f,
+    -0.615231574f, 0.78834641f, -0.97831738f, -0.207111374f, 0.427555084f, 0.903989315f, -0.634393275f, 0.773010433f,
+    -0.970031261f, -0.242980182f, 0.416429549f, 0.909168005f, -0.653172851f, 0.757208824f, -0.960430503f, -0.27851969f,
+    0.405241311f, 0.914209783f, -0.671558976f, 0.740951121f, -0.949528158f, -0.313681751f, 0.393992037f, 0.919113874f,
+    -0.689540565f, 0.724247098f, -0.937339008f, -0.348418683f, 0.382683426f, 0.923879504f, -0.707106769f, 0.707106769f,
+    -0.923879504f, -0.382683426f, 0.371317208f, 0.928506076f, -0.724247098f, 0.689540565f, -0.909168005f, -0.416429549f,
+    0.359895051f, 0.932992816f, -0.740951121f, 0.671558976f, -0.893224299f, -0.449611336f, 0.348418683f, 0.937339008f,
+    -0.757208824f, 0.653172851f, -0.876070082f, -0.482183784f, 0.336889863f, 0.941544056f, -0.773010433f, 0.634393275f,
+    -0.857728601f, -0.514102757f, 0.32531029f, 0.945607305f, -0.78834641f, 0.615231574f, -0.838224709f, -0.545324981f,
+    0.313681751f, 0.949528158f, -0.803207517f, 0.59569931f, -0.817584813f, -0.575808167f, 0.302005947f, 0.953306019f,
+    -0.817584813f, 0.575808167f, -0.795836926f, -0.605511069f, 0.290284663f, 0.956940353f, -0.831469595f, 0.555570245f,
+    -0.773010433f, -0.634393275f, 0.27851969f, 0.960430503f, -0.84485358f, 0.534997642f, -0.749136388f, -0.662415802f,
+    0.266712755f, 0.963776052f, -0.857728601f, 0.514102757f, -0.724247098f, -0.689540565f, 0.254865646f, 0.966976464f,
+    -0.870086968f, 0.492898196f, -0.698376238f, -0.715730846f, 0.242980182f, 0.970031261f, -0.881921291f, 0.471396744f,
+    -0.671558976f, -0.740951121f, 0.231058106f, 0.972939968f, -0.893224299f, 0.449611336f, -0.643831551f, -0.765167236f,
+    0.219101235f, 0.975702107f, -0.903989315f, 0.427555084f, -0.615231574f, -0.78834641f, 0.207111374f, 0.97831738f,
+    -0.914209783f, 0.405241311f, -0.585797846f, -0.81045717f, 0.195090324f, 0.980785251f, -0.923879504f, 0.382683426f,
+    -0.555570245f, -0.831469595f, 0.183039889f, 0.983105481f, -0.932992816f, 0.359895051f, -0.524589658f, -0.851355195f,
+    0.170961887f, 0.985277653f, -0.941544056f, 0.336889863f, -0.492898196f, -0.870086968f, 0.15885815f, 0.987301409f,
+    -0.949528158f, 0.313681751f, -0.460538715f, -0.887639642f, 0.146730468f, 0.989176512f, -0.956940353f, 0.290284663f,
+    -0.427555084f, -0.903989315f, 0.134580702f, 0.990902662f, -0.963776052f, 0.266712755f, -0.393992037f, -0.919113874f,
+    0.122410677f, 0.992479563f, -0.970031261f, 0.242980182f, -0.359895051f, -0.932992816f, 0.110222206f, 0.993906975f,
+    -0.975702107f, 0.219101235f, -0.32531029f, -0.945607305f, 0.0980171412f, 0.99518472f, -0.980785251f, 0.195090324f,
+    -0.290284663f, -0.956940353f, 0.0857973099f, 0.996312618f, -0.985277653f, 0.170961887f, -0.254865646f, -0.966976464f,
+    0.0735645667f, 0.997290432f, -0.989176512f, 0.146730468f, -0.219101235f, -0.975702107f, 0.061320737f, 0.998118103f,
+    -0.992479563f, 0.122410677f, -0.183039889f, -0.983105481f, 0.0490676761f, 0.99879545f, -0.99518472f, 0.0980171412f,
+    -0.146730468f, -0.989176512f, 0.0368072242f, 0.999322355f, -0.997290432f, 0.0735645667f, -0.110222206f, -0.993906975f,
+    0.024541229f, 0.999698818f, -0.99879545f, 0.0490676761f, -0.0735645667f, -0.997290432f, 0.0122715384f, 0.999924719f,
+    -0.999698818f, 0.024541229f, -0.0368072242f, -0.999322355f,
+};
+
+const int16_t fft_q15_twiddles_1024[1532] = {
+    32767, 0, 32766, 201, 32765, 402, 32761, 603,
+    32757, 804, 32752, 1005, 32745, 1206, 32737, 1407,
+    32728, 1608, 32717, 1809, 32705, 2009, 32692, 2210,
+    32678, 2410, 32663, 2611, 32646, 2811, 32628, 3012,
+    32609, 3212, 32589, 3412, 32567, 3612, 32545, 3811,
+    32521, 4011, 32495, 4210, 32469, 4410, 32441, 4609,
+    32412, 4808, 32382, 5007, 32351, 5205, 32318, 5404,
+    32285, 5602, 32250, 5800, 32213, 5998, 32176, 6195,
+    32137, 6393, 32098, 6590, 32057, 6786, 32014, 6983,
+    31971, 7179, 31926, 7375, 31880, 7571, 31833, 7767,
+    31785, 7962, 31736, 8157, 31685, 8351, 31633, 8545,
+    31580, 8739, 31526, 8933, 31470, 9126, 31414, 9319,
+    31356, 9512, 31297, 9704, 31237, 9896, 31176, 10087,
+    31113, 10278, 31050, 10469, 30985, 10659, 30919, 10849,
+    30852, 11039, 30783, 11228, 30714, 11417, 30643, 11605,
+    30571, 11793, 30498, 11980, 30424, 12167, 30349, 12353,
+    30273, 12539, 30195, 12725, 30117, 12910, 30037, 13094,
+    29956, 13279, 29874, 13462, 29791, 13645, 29706, 13828,
+    29621, 14010, 29534, 14191, 29447, 14372, 29358, 14553,
+    29268, 14732, 29177, 14912, 29085, 15090, 28992, 15269,
+    28898, 15446, 28803, 15623, 28706, 15800, 28609, 15976,
+    28510, 16151, 28411, 16325, 28310, 16499, 28208, 16673,
+    28105, 16846, 28001, 17018, 27896, 17189, 27790, 17360,
+    27683, 17530, 27575, 17700, 27466, 17869, 27356, 18037,
+    27245, 18204, 27133, 18371, 27019, 18537, 26905, 18703,
+    26790, 18868, 26674, 19032, 26556, 19195, 26438, 19357,
+    26319, 19519, 26198, 19680, 26077, 19841, 25955, 20000,
+    25832, 20159, 25708, 20317, 25582, 20475, 25456, 20631,
+    25329, 20787, 25201, 20942, 25072, 21096, 24942, 21250,
+    24811, 21403, 24680, 21554, 24547, 21705, 24413, 21856,
+    24279, 22005, 24143, 22154, 24007, 22301, 23870, 22448,
+    23731, 22594, 23592, 22739, 23452, 22884, 23311, 23027,
+    23170, 23170, 23027, 23311, 22884, 23452, 22739, 23592,
+    22594, 23731, 22448, 23870, 22301, 24007, 22154, 24143,
+    22005, 24279, 21856, 24413, 21705, 24547, 21554, 24680,
+    21403, 24811, 21250, 24942, 21096, 25072, 20942, 25201,
+    20787, 25329, 20631, 25456, 20475, 25582, 20317, 25708,
+    20159, 25832, 20000, 25955, 19841, 26077, 19680, 26198,
+    19519, 26319, 19357, 26438, 19195, 26556, 19032, 26674,
+    18868, 26790, 18703, 26905, 18537, 27019, 18371, 27133,
+    18204, 27245, 18037, 27356, 17869, 27466, 17700, 27575,
+    17530, 27683, 17360, 27790, 17189, 27896, 17018, 28001,
+    16846, 28105, 16673, 28208, 16499, 28310, 16325, 28411,
+    16151, 28510, 15976, 28609, 15800, 28706, 15623, 28803,
+    15446, 28898, 15269, 28992, 15090, 29085, 14912, 29177,
+    14732, 29268, 14553, 29358, 14372, 29447, 14191, 29534,
+    14010, 29621, 13828, 29706, 13645, 29791, 13462, 29874,
+    13279, 29956, 13094, 30037, 12910, 30117, 12725, 30195,
+    12539, 30273, 12353, 30349, 12167, 30424, 11980, 30498,
+    11793, 30571, 11605, 30643, 11417, 30714, 11228, 30783,
+    11039, 30852, 10849, 30919, 10659, 30985, 10469, 31050,
+    10278, 31113, 10087, 31176, 9896, 31237, 9704, 31297,
+    9512, 31356, 9319, 31414, 9126, 31470, 8933, 31526,
+    8739, 31580, 8545, 31633, 8351, 31685, 8157, 31736,
+    7962, 31785, 7767, 31833, 7571, 31880, 7375, 31926,
+    7179, 31971, 6983, 32014, 6786, 32057, 6590, 32098,
+    6393, 32137, 6195, 32176, 5998, 32213, 5800, 32250,
+    5602, 32285, 5404, 32318, 5205, 32351, 5007, 32382,
+    4808, 32412, 4609, 32441, 4410, 32469, 4210, 32495,
+    4011, 32521, 3811, 32545, 3612, 32567, 3412, 32589,
+    3212, 32609, 3012, 32628, 2811, 32646, 2611, 32663,
+    2410, 32678, 2210, 32692, 2009, 32705, 1809, 32717,
+    1608, 32728, 1407, 32737, 1206, 32745, 1005, 32752,
+    804, 32757, 603, 32761, 402, 32765, 201, 32766,
+    32767, 0, 0, 32767, 32767, 0, 23170, 23170,
+    0, 32767, -23170, 23170, 32767, 0, 30273, 12539,
+    23170, 23170, 12539, 30273, 0, 32767, -12539, 30273,
+    -23170, 23170, -30273, 12539, 32767, 0, 32137, 6393,
+    30273, 12539, 27245, 18204, 23170, 23170, 18204, 27245,
+    12539, 30273, 6393, 32137, 0, 32767, -6393, 32137,
+    -12539, 30273, -18204, 27245, -23170, 23170, -27245, 18204,
+    -30273, 12539, -32137, 6393, 32767, 0, 32609, 3212,
+    32137, 6393, 31356, 9512, 30273, 12539, 28898, 15446,
+    27245, 18204, 25329, 20787, 23170, 23170, 20787, 25329,
+    18204, 27245, 15446, 28898, 12539, 30273, 9512, 31356,
+    6393, 32137, 3212, 32609, 0, 32767, -3212, 32609,
+    -6393, 32137, -9512, 31356, -12539, 30273, -15446, 28898,
+    -18204, 27245, -20787, 25329, -23170, 23170, -25329, 20787,
+    -27245, 18204, -28898, 15446, -30273, 12539, -31356, 9512,
+    -32137, 6393, -32609, 3212, 32767, 0, 32728, 1608,
+    32609, 3212, 32412, 4808, 32137, 6393, 31785, 7962,
+    31356, 9512, 30852, 11039, 30273, 12539, 29621, 14010,
+    28898, 15446, 28105, 16846, 27245, 18204, 26319, 19519,
+    25329, 20787, 24279, 22005, 23170, 23170, 22005, 24279,
+    20787, 25329, 19519, 26319, 18204, 27245, 16846, 28105,
+    15446, 28898, 14010, 29621, 12539, 30273, 11039, 30852,
+    9512, 31356, 7962, 31785, 6393, 32137, 4808, 32412,
+    3212, 32609, 1608, 32728, 0, 32767, -1608, 32728,
+    -3212, 32609, -4808, 32412, -6393, 32137, -7962, 31785,
+    -9512, 31356, -11039, 30852, -12539, 30273, -14010, 29621,
+    -15446, 28898, -16846, 28105, -18204, 27245, -19519, 26319,
+    -20787, 25329, -22005, 24279, -23170, 23170, -24279, 22005,
+    -25329, 20787, -26319, 19519, -27245, 18204, -28105, 16846,
+    -28898, 15446, -29621, 14010, -30273, 12539, -30852, 11039,
+    -31356, 9512, -31785, 7962, -32137, 6393, -32412, 4808,
+    -32609, 3212, -32728, 1608, 32767, 0, 32757, 804,
+    32728, 1608, 32678, 2410, 32609, 3212, 32521, 4011,
+    32412, 4808, 32285, 5602, 32137, 6393, 31971, 7179,
+    31785, 7962, 31580, 8739, 31356, 9512, 31113, 10278,
+    30852, 11039, 30571, 11793, 30273, 12539, 29956, 13279,
+    29621, 14010, 29268, 14732, 28898, 15446, 28510, 16151,
+    28105, 16846, 27683, 17530, 27245, 18204, 26790, 18868,
+    26319, 19519, 25832, 20159, 25329, 20787, 24811, 21403,
+    24279, 22005, 23731, 22594, 23170, 23170, 22594, 23731,
+    22005, 24279, 21403, 24811, 20787, 25329, 20159, 25832,
+    19519, 26319, 18868, 26790, 18204, 27245, 17530, 27683,
+    16846, 28105, 16151, 28510, 15446, 28898, 14732, 29268,
+    14010, 29621, 13279, 29956, 12539, 30273, 11793, 30571,
+    11039, 30852, 10278, 31113, 9512, 31356, 8739, 31580,
+    7962, 31785, 7179, 31971, 6393, 32137, 5602, 32285,
+    4808, 32412, 4011, 32521, 3212, 32609, 2410, 32678,
+    1608, 32728, 804, 32757, 0, 32767, -804, 32757,
+    -1608, 32728, -2410, 32678, -3212, 32609, -4011, 32521,
+    -4808, 32412, -5602, 32285, -6393, 32137, -7179, 31971,
+    -7962, 31785, -8739, 31580, -9512, 31356, -10278, 31113,
+    -11039, 30852, -11793, 30571, -12539, 30273, -13279, 29956,
+    -14010, 29621, -14732, 29268, -15446, 28898, -16151, 28510,
+    -16846, 28105, -17530, 27683, -18204, 27245, -18868, 26790,
+    -19519, 26319, -20159, 25832, -20787, 25329, -21403, 24811,
+    -22005, 24279, -22594, 23731, -23170, 23170, -23731, 22594,
+    -24279, 22005, -24811, 21403, -25329, 20787, -25832, 20159,
+    -26319, 19519, -26790, 18868, -27245, 18204, -27683, 17530,
+    -28105, 16846, -28510, 16151, -28898, 15446, -29268, 14732,
+    -29621, 14010, -29956, 13279, -30273, 12539, -30571, 11793,
+    -30852, 11039, -31113, 10278, -31356, 9512, -31580, 8739,
+    -31785, 7962, -31971, 7179, -32137, 6393, -32285, 5602,
+    -32412, 4808, -32521, 4011, -32609, 3212, -32678, 2410,
+    -32728, 1608, -32757, 804, 32767, 0, 32765, 402,
+    32757, 804, 32745, 1206, 32728, 1608, 32705, 2009,
+    32678, 2410, 32646, 2811, 32609, 3212, 32567, 3612,
+    32521, 4011, 32469, 4410, 32412, 4808, 32351, 5205,
+    32285, 5602, 32213, 5998, 32137, 6393, 32057, 6786,
+    31971, 7179, 31880, 7571, 31785, 7962, 31685, 8351,
+    31580, 8739, 31470, 9126, 31356, 9512, 31237, 9896,
+    31113, 10278, 30985, 10659, 30852, 11039, 30714, 11417,
+    30571, 11793, 30424, 12167, 30273, 12539, 30117, 12910,
+    29956, 13279, 29791, 13645, 29621, 14010, 29447, 14372,
+    29268, 14732, 29085, 15090, 28898, 15446, 28706, 15800,
+    28510, 16151, 28310, 16499, 28105, 16846, 27896, 17189,
+    27683, 17530, 27466, 17869, 27245, 18204, 27019, 18537,
+    26790, 18868, 26556, 19195, 26319, 19519, 26077, 19841,
+    25832, 20159, 25582, 20475, 25329, 20787, 25072, 21096,
+    24811, 21403, 24547, 21705, 24279, 22005, 24007, 22301,
+    23731, 22594, 23452, 22884, 23170, 23170, 22884, 23452,
+    22594, 23731, 22301, 24007, 22005, 24279, 21705, 24547,
+    21403, 24811, 21096, 25072, 20787, 25329, 20475, 25582,
+    20159, 25832, 19841, 26077, 19519, 26319, 19195, 26556,
+    18868, 26790, 18537, 27019, 18204, 27245, 17869, 27466,
+    17530, 27683, 17189, 27896, 16846, 28105, 16499, 28310,
+    16151, 28510, 15800, 28706, 15446, 28898, 15090, 29085,
+    14732, 29268, 14372, 29447, 14010, 29621, 13645, 29791,
+    13279, 29956, 12910, 30117, 12539, 30273, 12167, 30424,
+    11793, 30571, 11417, 30714, 11039, 30852, 10659, 30985,
+    10278, 31113, 9896, 31237, 9512, 31356, 9126, 31470,
+    8739, 31580, 8351, 31685, 7962, 31785, 7571, 31880,
+    7179, 31971, 6786, 32057, 6393, 32137, 5998, 32213,
+    5602, 32285, 5205, 32351, 4808, 32412, 4410, 32469,
+    4011, 32521, 3612, 32567, 3212, 32609, 2811, 32646,
+    2410, 32678, 2009, 32705, 1608, 32728, 1206, 32745,
+    804, 32757, 402, 32765, 0, 32767, -402, 32765,
+    -804, 32757, -1206, 32745, -1608, 32728, -2009, 32705,
+    -2410, 32678, -2811, 32646, -3212, 32609, -3612, 32567,
+    -4011, 32521, -4410, 32469, -4808, 32412, -5205, 32351,
+    -5602, 32285, -5998, 32213, -6393, 32137, -6786, 32057,
+    -7179, 31971, -7571, 31880, -7962, 31785, -8351, 31685,
+    -8739, 31580, -9126, 31470, -9512, 31356, -9896, 31237,
+    -10278, 31113, -10659, 30985, -11039, 30852, -11417, 30714,
+    -11793, 30571, -12167, 30424, -12539, 30273, -12910, 30117,
+    -13279, 29956, -13645, 29791, -14010, 29621, -14372, 29447,
+    -14732, 29268, -15090, 29085, -15446, 28898, -15800, 28706,
+    -16151, 28510, -16499, 28310, -16846, 28105, -17189, 27896,
+    -17530, 27683, -17869, 27466, -18204, 27245, -18537, 27019,
+    -18868, 26790, -19195, 26556, -19519, 26319, -19841, 26077,
+    -20159, 25832, -20475, 25582, -20787, 25329, -21096, 25072,
+    -21403, 24811, -21705, 24547, -22005, 24279, -22301, 24007,
+    -22594, 23731, -22884, 23452, -23170, 23170, -23452, 22884,
+    -23731, 22594, -24007, 22301, -24279, 22005, -24547, 21705,
+    -24811, 21403, -25072, 21096, -25329, 20787, -25582, 20475,
+    -25832, 20159, -26077, 19841, -26319, 19519, -26556, 19195,
+    -26790, 18868, -27019, 18537, -27245, 18204, -27466, 17869,
+    -27683, 17530, -27896, 17189, -28105, 16846, -28310, 16499,
+    -28510, 16151, -28706, 15800, -28898, 15446, -29085, 15090,
+    -29268, 14732, -29447, 14372, -29621, 14010, -29791, 13645,
+    -29956, 13279, -30117, 12910, -30273, 12539, -30424, 12167,
+    -30571, 11793, -30714, 11417, -30852, 11039, -30985, 10659,
+    -31113, 10278, -31237, 9896, -31356, 9512, -31470, 9126,
+    -31580, 8739, -31685, 8351, -31785, 7962, -31880, 7571,
+    -31971, 7179, -32057, 6786, -32137, 6393, -32213, 5998,
+    -32285, 5602, -32351, 5205, -32412, 4808, -32469, 4410,
+    -32521, 4011, -32567, 3612, -32609, 3212, -32646, 2811,
+    -32678, 2410, -32705, 2009, -32728, 1608, -32745, 1206,
+    -32757, 804, -32765, 402,
+};
+
+const float fft_radix4_real_twiddles_2048[3064] = {
+    1.0f, 0.0f, 0.999995291f, 0.00306795677f, 0.999981165f, 0.00613588467f, 0.999957621f, 0.00920375437f,
+    0.999924719f, 0.0122715384f, 0.99988234f, 0.015339206f, 0.999830604f, 0.0184067301f, 0.99976939f, 0.0214740802f,
+    0.999698818f, 0.024541229f, 0.999618828f, 0.027608145f, 0.999529421f, 0.030674804f, 0.999430597f, 0.0337411724f,
+    0.999322355f, 0.0368072242f, 0.999204755f, 0.0398729257f, 0.999077737f, 0.0429382585f, 0.998941302f, 0.0460031815f,
+    0.99879545f, 0.0490676761f, 0.998640239f, 0.052131705f, 0.998475552f, 0.0551952459f, 0.998301566f, 0.0582582653f,
+    0.998118103f, 0.061320737f, 0.997925282f, 0.0643826276f, 0.997723043f, 0.0674439222f, 0.997511446f, 0.070504576f,
+    0.997290432f, 0.0735645667f, 0.997060061f, 0.0766238645f, 0.996820271f, 0.0796824396f, 0.996571124f, 0.0827402622f,
+    0.996312618f, 0.0857973099f, 0.996044695f, 0.0888535529f, 0.995767415f, 0.0919089541f, 0.995480776f, 0.0949634984f,
+    0.99518472f, 0.0980171412f, 0.994879305f, 0.10106986f, 0.994564593f, 0.104121633f, 0.994240463f, 0.107172422f,
+    0.993906975f, 0.110222206f, 0.993564129f, 0.113270953f, 0.993211925f, 0.116318628f, 0.992850423f, 0.119365215f,
+    0.992479563f, 0.122410677f, 0.992099285f, 0.125454977f, 0.991709769f, 0.128498107f, 0.991310835f, 0.13154003f,
+    0.990902662f, 0.134580702f, 0.990485072f, 0.137620121f, 0.990058184f, 0.140658244f, 0.989621997f, 0.143695027f,
+    0.989176512f, 0.146730468f, 0.988721669f, 0.149764538f, 0.988257587f, 0.152797192f, 0.987784147f, 0.155828401f,
+    0.987301409f, 0.15885815f, 0.986809373f, 0.161886394f, 0.986308098f, 0.164913118f, 0.985797524f, 0.167938292f,
+    0.985277653f, 0.170961887f, 0.984748483f, 0.173983872f, 0.984210074f, 0.177004218f, 0.983662426f, 0.180022895f,
+    0.983105481f, 0.183039889f, 0.982539296f, 0.186055154f, 0.981963873f, 0.18906866f, 0.981379211f, 0.192080393f,
+    0.980785251f, 0.195090324f, 0.980182111f, 0.198098406f, 0.979569793f, 0.201104641f, 0.978948176f, 0.204108968f,
+    0.97831738f, 0.207111374f, 0.977677345f, 0.210111842f, 0.977028131f, 0.213110313f, 0.976369739f, 0.216106802f,
+    0.975702107f, 0.219101235f, 0.975025356f, 0.222093627f, 0.974339366f, 0.225083917f, 0.973644257f, 0.228072077f,
+    0.972939968f, 0.231058106f, 0.972226501f, 0.234041959f, 0.971503913f, 0.237023607f, 0.970772147f, 0.24000302f,
+    0.970031261f, 0.242980182f, 0.969281256f, 0.24595505f, 0.968522072f, 0.248927608f, 0.967753828f, 0.251897812f,
+    0.966976464f, 0.254865646f, 0.966189981f, 0.257831097f, 0.965394437f, 0.260794103f, 0.964589775f, 0.263754666f,
+    0.963776052f, 0.266712755f, 0.962953269f, 0.269668311f, 0.962121427f, 0.272621363f, 0.961280465f, 0.275571823f,
+    0.960430503f, 0.27851969f, 0.95957154f, 0.281464934f, 0.958703458f, 0.284407526f, 0.957826436f, 0.287347466f,
+    0.956940353f, 0.290284663f, 0.95604527f, 0.293219149f, 0.955141187f, 0.296150893f, 0.954228103f, 0.299079835f,
+    0.953306019f, 0.302005947f, 0.952374995f, 0.304929227f, 0.95143503f, 0.307849646f, 0.950486064f, 0.310767144f,
+    0.949528158f, 0.313681751f, 0.94856137f, 0.316593379f, 0.947585583f, 0.319502026f, 0.946600914f, 0.322407693f,
+    0.945607305f, 0.32531029f, 0.944604814f, 0.328209847f, 0.943593442f, 0.331106305f, 0.94257319f, 0.333999664f,
+    0.941544056f, 0.336889863f, 0.940506041f, 0.339776874f, 0.939459205f, 0.342660725f, 0.938403547f, 0.345541328f,
+    0.937339008f, 0.348418683f, 0.936265647f, 0.351292759f, 0.935183525f, 0.354163527f, 0.934092522f, 0.357030958f,
+    0.932992816f, 0.359895051f, 0.931884289f, 0.362755716f, 0.93076694f, 0.365612984f, 0.929640889f, 0.368466824f,
+    0.928506076f, 0.371317208f, 0.927362502f, 0.374164075f, 0.926210225f, 0.377007425f, 0.925049245f, 0.379847199f,
+    0.923879504f, 0.382683426f, 0.92270112f, 0.385516047f, 0.921514034f, 0.388345033f, 0.920318305f, 0.391170382f,
+    0.919113874f, 0.393992037f, 0.917900801f, 0.396809995f, 0.916679084f, 0.399624199f, 0.915448725f, 0.402434647f,
+    0.914209783f, 0.405241311f, 0.912962198f, 0.408044159f, 0.91170603f, 0.410843164f, 0.910441279f, 0.413638324f,
+    0.909168005f, 0.416429549f, 0.907886088f, 0.419216901f, 0.906595707f, 0.422000259f, 0.905296743f, 0.424779683f,
+    0.903989315f, 0.427555084f, 0.902673304f, 0.430326492f, 0.901348829f, 0.433093816f, 0.900015891f, 0.435857087f,
+    0.898674488f, 0.438616246f, 0.897324562f, 0.441371262f, 0.895966232f, 0.444122136f, 0.894599497f, 0.446868837f,
+    0.893224299f, 0.449611336f, 0.891840696f, 0.452349573f, 0.890448749f, 0.455083579f, 0.889048338f, 0.457813293f,
+    0.887639642f, 0.460538715f, 0.886222541f, 0.463259786f, 0.884797096f, 0.465976506f, 0.883363366f, 0.468688816f,
+    0.881921291f, 0.471396744f, 0.880470872f, 0.474100202f, 0.879012227f, 0.47679922f, 0.877545297f, 0.479493767f,
+    0.876070082f, 0.482183784f, 0.874586642f, 0.484869242f, 0.873094976f, 0.487550169f, 0.871595085f, 0.490226477f,
+    0.870086968f, 0.492898196f, 0.868570685f, 0.495565265f, 0.867046237f, 0.498227656f, 0.865513623f, 0.500885367f,
+    0.863972843f, 0.50353837f, 0.862423956f, 0.506186664f, 0.860866964f, 0.50883013f, 0.859301805f, 0.511468828f,
+    0.857728601f, 0.514102757f, 0.856147349f, 0.516731799f, 0.854557991f, 0.519356012f, 0.852960587f, 0.521975279f,
+    0.851355195f, 0.524589658f, 0.849741757f, 0.527199149f, 0.848120332f, 0.529803634f, 0.84649092f, 0.532403111f,
+    0.84485358f, 0.534997642f, 0.843208253f, 0.537587047f, 0.841554999f, 0.540171444f, 0.839893818f, 0.542750776f,
+    0.838224709f, 0.545324981f, 0.836547732f, 0.547894061f, 0.834862888f, 0.550457954f, 0.833170176f, 0.553016722f,
+    0.831469595f, 0.555570245f, 0.829761207f, 0.558118522f, 0.82804507f, 0.560661554f, 0.826321065f, 0.563199341f,
+    0.824589312f, 0.565731823f, 0.82284981f, 0.568258941f, 0.8211025f, 0.570780754f, 0.819347501f, 0.573297143f,
+    0.817584813f, 0.575808167f, 0.815814435f, 0.578313768f, 0.81403631f, 0.580813944f, 0.812250614f, 0.583308637f,
+    0.81045717f, 0.585797846f, 0.808656156f, 0.588281572f, 0.806847572f, 0.590759695f, 0.805031359f, 0.593232274f,
+    0.803207517f, 0.59569931f, 0.801376164f, 0.598160684f, 0.799537241f, 0.600616455f, 0.797690868f, 0.603066623f,
+    0.795836926f, 0.605511069f, 0.793975472f, 0.607949793f, 0.792106569f, 0.610382795f, 0.790230215f, 0.612810075f,
+    0.78834641f, 0.615231574f, 0.786455214f, 0.61764729f, 0.784556568f, 0.620057225f, 0.78265059f, 0.622461259f,
+    0.780737221f, 0.624859512f, 0.778816521f, 0.627251804f, 0.77688849f, 0.629638255f, 0.774953127f, 0.632018745f,
+    0.773010433f, 0.634393275f, 0.771060526f, 0.636761844f, 0.769103348f, 0.639124453f, 0.767138898f, 0.641481042f,
+    0.765167236f, 0.643831551f, 0.763188422f, 0.64617604f, 0.761202395f, 0.64851439f, 0.759209216f, 0.65084666f,
+    0.757208824f, 0.653172851f, 0.755201399f, 0.655492842f, 0.753186822f, 0.657806695f, 0.751165152f, 0.660114348f,
+    0.749136388f, 0.662415802f, 0.747100592f, 0.664710999f, 0.745057762f, 0.666999936f, 0.743007958f, 0.669282615f,
+    0.740951121f, 0.671558976f, 0.73888731f, 0.673829019f, 0.736816585f, 0.676092684f, 0.734738886f, 0.678350031f,
+    0.732654274f, 0.680601001f, 0.730562747f, 0.682845533f, 0.728464365f, 0.685083687f, 0.726359129f, 0.687315345f,
+    0.724247098f, 0.689540565f, 0.722128212f, 0.691759229f, 0.720002532f, 0.693971455f, 0.717870057f, 0.696177125f,
+    0.715730846f, 0.698376238f, 0.71358484f, 0.700568795f, 0.711432219f, 0.702754736f, 0.709272802f, 0.704934061f,
+    0.707106769f, 0.707106769f, 0.704934061f, 0.709272802f, 0.702754736f, 0.711432219f, 0.700568795f, 0.71358484f,
+    0.698376238f, 0.715730846f, 0.696177125f, 0.717870057f, 0.693971455f, 0.720002532f, 0.691759229f, 0.722128212f,
+    0.689540565f, 0.724247098f, 0.687315345f, 0.726359129f, 0.685083687f, 0.728464365f, 0.682845533f, 0.730562747f,
+    0.680601001f, 0.732654274f, 0.678350031f, 0.734738886f, 0.676092684f, 0.736816585f, 0.673829019f, 0.73888731f,
+    0.671558976f, 0.740951121f, 0.669282615f, 0.743007958f, 0.666999936f, 0.745057762f, 0.664710999f, 0.747100592f,
+    0.662415802f, 0.749136388f, 0.660114348f, 0.751165152f, 0.657806695f, 0.753186822f, 0.655492842f, 0.755201399f,
+    0.653172851f, 0.757208824f, 0.65084666f, 0.759209216f, 0.64851439f, 0.761202395f, 0.64617604f, 0.763188422f,
+    0.643831551f, 0.765167236f, 0.641481042f, 0.767138898f, 0.639124453f, 0.769103348f, 0.636761844f, 0.771060526f,
+    0.634393275f, 0.773010433f, 0.632018745f, 0.774953127f, 0.629638255f, 0.77688849f, 0.627251804f, 0.778816521f,
+    0.624859512f, 0.780737221f, 0.622461259f, 0.78265059f, 0.620057225f, 0.784556568f, 0.61764729f, 0.786455214f,
+    0.615231574f, 0.78834641f, 0.612810075f, 0.790230215f, 0.610382795f, 0.792106569f, 0.607949793f, 0.793975472f,
+    0.605511069f, 0.795836926f, 0.603066623f, 0.797690868f, 0.600616455f, 0.799537241f, 0.598160684f, 0.801376164f,
+    0.59569931f, 0.803207517f, 0.593232274f, 0.805031359f, 0.590759695f, 0.806847572f, 0.588281572f, 0.808656156f,
+    0.585797846f, 0.81045717f, 0.583308637f, 0.812250614f, 0.580813944f, 0.81403631f, 0.578313768f, 0.815814435f,
+    0.575808167f, 0.817584813f, 0.573297143f, 0.819347501f, 0.570780754f, 0.8211025f, 0.568258941f, 0.82284981f,
+    0.565731823f, 0.824589312f, 0.563199341f, 0.826321065f, 0.560661554f, 0.82804507f, 0.558118522f, 0.829761207f,
+    0.555570245f, 0.831469595f, 0.553016722f, 0.833170176f, 0.550457954f, 0.834862888f, 0.547894061f, 0.836547732f,
+    0.545324981f, 0.838224709f, 0.542750776f, 0.839893818f, 0.540171444f, 0.841554999f, 0.537587047f, 0.843208253f,
+    0.534997642f, 0.84485358f, 0.532403111f, 0.84649092f, 0.529803634f, 0.848120332f, 0.527199149f, 0.849741757f,
+    0.524589658f, 0.851355195f, 0.521975279f, 0.852960587f, 0.519356012f, 0.854557991f, 0.516731799f, 0.856147349f,
+    0.514102757f, 0.857728601f, 0.511468828f, 0.859301805f, 0.50883013f, 0.860866964f, 0.506186664f, 0.862423956f,
+    0.50353837f, 0.863972843f, 0.500885367f, 0.865513623f, 0.498227656f, 0.867046237f, 0.495565265f, 0.868570685f,
+    0.492898196f, 0.870086968f, 0.490226477f, 0.871595085f, 0.487550169f, 0.873094976f, 0.484869242f, 0.874586642f,
+    0.482183784f, 0.876070082f, 0.479493767f, 0.877545297f, 0.47679922f, 0.879012227f, 0.474100202f, 0.880470872f,
+    0.471396744f, 0.881921291f, 0.468688816f, 0.883363366f, 0.465976506f, 0.884797096f, 0.463259786f, 0.886222541f,
+    0.460538715f, 0.887639642f, 0.457813293f, 0.889048338f, 0.455083579f, 0.890448749f, 0.452349573f, 0.891840696f,
+    0.449611336f, 0.893224299f, 0.446868837f, 0.894599497f, 0.444122136f, 0.895966232f, 0.441371262f, 0.897324562f,
+    0.438616246f, 0.898674488f, 0.435857087f, 0.900015891f, 0.433093816f, 0.901348829f, 0.430326492f, 0.902673304f,
+    0.427555084f, 0.903989315f, 0.424779683f, 0.905296743f, 0.422000259f, 0.906595707f, 0.419216901f, 0.907886088f,
+    0.416429549f, 0.909168005f, 0.413638324f, 0.910441279f, 0.410843164f, 0.91170603f, 0.408044159f, 0.912962198f,
+    0.405241311f, 0.914209783f, 0.402434647f, 0.915448725f, 0.399624199f, 0.916679084f, 0.396809995f, 0.917900801f,
+    0.393992037f, 0.919113874f, 0.391170382f, 0.920318305f, 0.388345033f, 0.921514034f, 0.385516047f, 0.92270112f,
+    0.382683426f, 0.923879504f, 0.379847199f, 0.925049245f, 0.377007425f, 0.926210225f, 0.374164075f, 0.927362502f,
+    0.371317208f, 0.928506076f, 0.368466824f, 0.929640889f, 0.365612984f, 0.93076694f, 0.362755716f, 0.931884289f,
+    0.359895051f, 0.932992816f, 0.357030958f, 0.934092522f, 0.354163527f, 0.935183525f, 0.351292759f, 0.936265647f,
+    0.348418683f, 0.937339008f, 0.345541328f, 0.938403547f, 0.342660725f, 0.939459205f, 0.339776874f, 0.940506041f,
+    0.336889863f, 0.941544056f, 0.333999664f, 0.94257319f, 0.331106305f, 0.943593442f, 0.328209847f, 0.944604814f,
+    0.32531029f, 0.945607305f, 0.322407693f, 0.946600914f, 0.319502026f, 0.947585583f, 0.316593379f, 0.94856137f,
+    0.313681751f, 0.949528158f, 0.310767144f, 0.950486064f, 0.307849646f, 0.95143503f, 0.304929227f, 0.952374995f,
+    0.302005947f, 0.953306019f, 0.299079835f, 0.954228103f, 0.296150893f, 0.955141187f, 0.293219149f, 0.95604527f,
+    0.290284663f, 0.956940353f, 0.287347466f, 0.957826436f, 0.284407526f, 0.958703458f, 0.281464934f, 0.95957154f,
+    0.27851969f, 0.960430503f, 0.275571823f, 0.961280465f, 0.272621363f, 0.962121427f, 0.269668311f, 0.962953269f,
+    0.266712755f, 0.963776052f, 0.263754666f, 0.964589775f, 0.260794103f, 0.965394437f, 0.257831097f, 0.966189981f,
+    0.254865646f, 0.966976464f, 0.251897812f, 0.967753828f, 0.248927608f, 0.968522072f, 0.24595505f, 0.969281256f,
+    0.242980182f, 0.970031261f, 0.24000302f, 0.970772147f, 0.237023607f, 0.971503913f, 0.234041959f, 0.972226501f,
+    0.231058106f, 0.972939968f, 0.228072077f, 0.973644257f, 0.225083917f, 0.974339366f, 0.222093627f, 0.975025356f,
+    0.219101235f, 0.975702107f, 0.216106802f, 0.976369739f, 0.213110313f, 0.977028131f, 0.210111842f, 0.977677345f,
+    0.207111374f, 0.97831738f, 0.204108968f, 0.978948176f, 0.201104641f, 0.979569793f, 0.198098406f, 0.980182111f,
+    0.195090324f, 0.980785251f, 0.192080393f, 0.981379211f, 0.18906866f, 0.981963873f, 0.186055154f, 0.982539296f,
+    0.183039889f, 0.983105481f, 0.180022895f, 0.983662426f, 0.177004218f, 0.984210074f, 0.173983872f, 0.984748483f,
+    0.170961887f, 0.985277653f, 0.167938292f, 0.985797524f, 0.164913118f, 0.986308098f, 0.161886394f, 0.986809373f,
+    0.15885815f, 0.987301409f, 0.155828401f, 0.987784147f, 0.152797192f, 0.988257587f, 0.149764538f, 0.988721669f,
+    0.146730468f, 0.989176512f, 0.143695027f, 0.989621997f, 0.140658244f, 0.990058184f, 0.137620121f, 0.990485072f,
+    0.134580702f, 0.990902662f, 0.13154003f, 0.991310835f, 0.128498107f, 0.991709769f, 0.125454977f, 0.992099285f,
+    0.122410677f, 0.992479563f, 0.119365215f, 0.992850423f, 0.116318628f, 0.993211925f, 0.113270953f, 0.993564129f,
+    0.110222206f, 0.993906975f, 0.107172422f, 0.994240463f, 0.104121633f, 0.994564593f, 0.10106986f, 0.994879305f,
+    0.0980171412f, 0.99518472f, 0.0949634984f, 0.995480776f, 0.0919089541f, 0.995767415f, 0.0888535529f, 0.996044695f,
+    0.0857973099f, 0.996312618f, 0.0827402622f, 0.996571124f, 0.0796824396f, 0.996820271f, 0.0766238645f, 0.997060061f,
+    0.0735645667f, 0.997290432f, 0.070504576f, 0.997511446f, 0.0674439222f, 0.997723043f, 0.0643826276f, 0.997925282f,
+    0.061320737f, 0.998118103f, 0.0582582653f, 0.998301566f, 0.0551952459f, 0.998475552f, 0.052131705f, 0.998640239f,
+    0.0490676761f, 0.99879545f, 0.0460031815f, 0.998941302f, 0.0429382585f, 0.999077737f, 0.0398729257f, 0.999204755f,
+    0.0368072242f, 0.999322355f, 0.0337411724f, 0.999430597f, 0.030674804f, 0.999529421f, 0.027608145f, 0.999618828f,
+    0.024541229f, 0.999698818f, 0.0214740802f, 0.99976939f, 0.0184067301f, 0.999830604f, 0.015339206f, 0.99988234f,
+    0.0122715384f, 0.999924719f, 0.00920375437f, 0.999957621f, 0.00613588467f, 0.999981165f, 0.00306795677f, 0.999995291f,
+    1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.923879504f, 0.382683426f,
+    0.707106769f, 0.707106769f, 0.382683426f, 0.923879504f, 0.707106769f, 0.707106769f, 6.12323426e-17f, 1.0f,
+    -0.707106769f, 0.707106769f, 0.382683426f, 0.923879504f, -0.707106769f, 0.707106769f, -0.923879504f, -0.382683426f,
+    1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.99518472f, 0.0980171412f,
+    0.980785251f, 0.195090324f, 0.956940353f, 0.290284663f, 0.980785251f, 0.195090324f, 0.923879504f, 0.382683426f,
+    0.831469595f, 0.555570245f, 0.956940353f, 0.290284663f, 0.831469595f, 0.555570245f, 0.634393275f, 0.773010433f,
+    0.923879504f, 0.382683426f, 0.707106769f, 0.707106769f, 0.382683426f, 0.923879504f, 0.881921291f, 0.471396744f,
+    0.555570245f, 0.831469595f, 0.0980171412f, 0.99518472f, 0.831469595f, 0.555570245f, 0.382683426f, 0.923879504f,
+    -0.195090324f, 0.980785251f, 0.773010433f, 0.634393275f, 0.195090324f, 0.980785251f, -0.471396744f, 0.881921291f,
+    0.707106769f, 0.707106769f, 6.12323426e-17f, 1.0f, -0.707106769f, 0.707106769f, 0.634393275f, 0.773010433f,
+    -0.195090324f, 0.980785251f, -0.881921291f, 0.471396744f, 0.555570245f, 0.831469595f, -0.382683426f, 0.923879504f,
+    -0.980785251f, 0.195090324f, 0.471396744f, 0.881921291f, -0.555570245f, 0.831469595f, -0.99518472f, -0.0980171412f,
+    0.382683426f, 0.923879504f, -0.707106769f, 0.707106769f, -0.923879504f, -0.382683426f, 0.290284663f, 0.956940353f,
+    -0.831469595f, 0.555570245f, -0.773010433f, -0.634393275f, 0.195090324f, 0.980785251f, -0.923879504f, 0.382683426f,
+    -0.555570245f, -0.831469595f, 0.0980171412f, 0.99518472f, -0.980785251f, 0.195090324f, -0.290284663f, -0.956940353f,
+    1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.999698818f, 0.024541229f,
+    0.99879545f, 0.0490676761f, 0.997290432f, 0.0735645667f, 0.99879545f, 0.0490676761f, 0.99518472f, 0.0980171412f,
+    0.989176512f, 0.146730468f, 0.997290432f, 0.0735645667f, 0.989176512f, 0.146730468f, 0.975702107f, 0.219101235f,
+    0.99518472f, 0.0980171412f, 0.980785251f, 0.195090324f, 0.956940353f, 0.290284663f, 0.992479563f, 0.122410677f,
+    0.970031261f, 0.242980182f, 0.932992816f, 0.359895051f, 0.989176512f, 0.146730468f, 0.956940353f, 0.290284663f,
+    0.903989315f, 0.427555084f, 0.985277653f, 0.170961887f, 0.941544056f, 0.336889863f, 0.870086968f, 0.492898196f,
+    0.980785251f, 0.195090324f, 0.923879504f, 0.382683426f, 0.831469595f, 0.555570245f, 0.975702107f, 0.219101235f,
+    0.903989315f, 0.427555084f, 0.78834641f, 0.615231574f, 0.970031261f, 0.242980182f, 0.881921291f, 0.471396744f,
+    0.740951121f, 0.671558976f, 0.963776052f, 0.266712755f, 0.857728601f, 0.514102757f, 0.689540565f, 0.724247098f,
+    0.956940353f, 0.290284663f, 0.831469595f, 0.555570245f, 0.634393275f, 0.773010433f, 0.949528158f, 0.313681751f,
+    0.803207517f, 0.59569931f, 0.575808167f, 0.817584813f, 0.941544056f, 0.336889863f, 0.773010433f, 0.634393275f,
+    0.514102757f, 0.857728601f, 0.932992816f, 0.359895051f, 0.740951121f, 0.671558976f, 0.449611336f, 0.893224299f,
+    0.923879504f, 0.382683426f, 0.707106769f, 0.707106769f, 0.382683426f, 0.923879504f, 0.914209783f, 0.405241311f,
+    0.671558976f, 0.740951121f, 0.313681751f, 0.949528158f, 0.903989315f, 0.427555084f, 0.634393275f, 0.773010433f,
+    0.242980182f, 0.970031261f, 0.893224299f, 0.449611336f, 0.59569931f, 0.803207517f, 0.170961887f, 0.985277653f,
+    0.881921291f, 0.471396744f, 0.555570245f, 0.831469595f, 0.0980171412f, 0.99518472f, 0.870086968f, 0.492898196f,
+    0.514102757f, 0.857728601f, 0.024541229f, 0.999698818f, 0.857728601f, 0.514102757f, 0.471396744f, 0.881921291f,
+    -0.0490676761f, 0.99879545f, 0.84485358f, 0.534997642f, 0.427555084f, 0.903989315f, -0.122410677f, 0.992479563f,
+    0.831469595f, 0.555570245f, 0.382683426f, 0.923879504f, -0.195090324f, 0.980785251f, 0.817584813f, 0.575808167f,
+    0.336889863f, 0.941544056f, -0.266712755f, 0.963776052f, 0.803207517f, 0.59569931f, 0.290284663f, 0.956940353f,
+    -0.336889863f, 0.941544056f, 0.78834641f, 0.615231574f, 0.242980182f, 0.970031261f, -0.405241311f, 0.914209783f,
+    0.773010433f, 0.634393275f, 0.195090324f, 0.980785251f, -0.471396744f, 0.881921291f, 0.757208824f, 0.653172851f,
+    0.146730468f, 0.989176512f, -0.534997642f, 0.84485358f, 0.740951121f, 0.671558976f, 0.0980171412f, 0.99518472f,
+    -0.59569931f, 0.803207517f, 0.724247098f, 0.689540565f, 0.0490676761f, 0.99879545f, -0.653172851f, 0.757208824f,
+    0.707106769f, 0.707106769f, 6.12323426e-17f, 1.0f, -0.707106769f, 0.707106769f, 0.689540565f, 0.724247098f,
+    -0.0490676761f, 0.99879545f, -0.757208824f, 0.653172851f, 0.671558976f, 0.740951121f, -0.0980171412f, 0.99518472f,
+    -0.803207517f, 0.59569931f, 0.653172851f, 0.757208824f, -0.146730468f, 0.989176512f, -0.84485358f, 0.534997642f,
+    0.634393275f, 0.773010433f, -0.195090324f, 0.980785251f, -0.881921291f, 0.471396744f, 0.615231574f, 0.78834641f,
+    -0.242980182f, 0.970031261f, -0.914209783f, 0.405241311f, 0.59569931f, 0.803207517f, -0.290284663f, 0.956940353f,
+    -0.941544056f, 0.336889863f, 0.575808167f, 0.817584813f, -0.336889863f, 0.941544056f, -0.963776052f, 0.266712755f,
+    0.555570245f, 0.831469595f, -0.382683426f, 0.923879504f, -0.980785251f, 0.195090324f, 0.534997642f, 0.84485358f,
+    -0.427555084f, 0.903989315f, -0.992479563f, 0.122410677f, 0.514102757f, 0.857728601f, -0.471396744f, 0.881921291f,
+    -0.99879545f, 0.0490676761f, 0.492898196f, 0.870086968f, -0.514102757f, 0.857728601f, -0.999698818f, -0.024541229f,
+    0.471396744f, 0.881921291f, -0.555570245f, 0.831469595f, -0.99518472f, -0.0980171412f, 0.449611336f, 0.893224299f,
+    -0.59569931f, 0.803207517f, -0.985277653f, -0.170961887f, 0.427555084f, 0.903989315f, -0.634393275f, 0.773010433f,
+    -0.970031261f, -0.242980182f, 0.405241311f, 0.914209783f, -0.671558976f, 0.740951121f, -0.949528158f, -0.313681751f,
+    0.382683426f, 0.923879504f, -0.707106769f, 0.707106769f, -0.923879504f, -0.382683426f, 0.359895051f, 0.932992816f,
+    -0.740951121f, 0.671558976f, -0.893224299f, -0.449611336f, 0.336889863f, 0.941544056f, -0.773010433f, 0.634393275f,
+    -0.857728601f, -0.514102757f, 0.313681751f, 0.949528158f, -0.803207517f, 0.59569931f, -0.817584813f, -0.575808167f,
+    0.290284663f, 0.956940353f, -0.831469595f, 0.555570245f, -0.773010433f, -0.634393275f, 0.266712755f, 0.963776052f,
+    -0.857728601f, 0.514102757f, -0.724247098f, -0.689540565f, 0.242980182f, 0.970031261f, -0.881921291f, 0.471396744f,
+    -0.671558976f, -0.740951121f, 0.219101235f, 0.975702107f, -0.903989315f, 0.427555084f, -0.615231574f, -0.78834641f,
+    0.195090324f, 0.980785251f, -0.923879504f, 0.382683426f, -0.555570245f, -0.831469595f, 0.170961887f, 0.985277653f,
+    -0.941544056f, 0.336889863f, -0.492898196f, -0.870086968f, 0.146730468f, 0.989176512f, -0.956940353f, 0.290284663f,
+    -0.427555084f, -0.903989315f, 0.122410677f, 0.992479563f, -0.970031261f, 0.242980182f, -0.359895051f, -0.932992816f,
+    0.0980171412f, 0.99518472f, -0.980785251f, 0.195090324f, -0.290284663f, -0.956940353f, 0.0735645667f, 0.997290432f,
+    -0.989176512f, 0.146730468f, -0.219101235f, -0.975702107f, 0.0490676761f, 0.99879545f, -0.99518472f, 0.0980171412f,
+    -0.146730468f, -0.989176512f, 0.024541229f, 0.999698818f, -0.99879545f, 0.0490676761f, -0.0735645667f, -0.997290432f,
+    1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.999981165f, 0.00613588467f,
+    0.999924719f, 0.0122715384f, 0.999830604f, 0.0184067301f, 0.999924719f, 0.0122715384f, 0.999698818f, 0.024541229f,
+    0.999322355f, 0.0368072242f, 0.999830604f, 0.0184067301f, 0.999322355f, 0.0368072242f, 0.998475552f, 0.0551952459f,
+    0.999698818f, 0.024541229f, 0.99879545f, 0.0490676761f, 0.997290432f, 0.0735645667f, 0.999529421f, 0.030674804f,
+    0.998118103f, 0.061320737f, 0.995767415f, 0.0919089541f, 0.999322355f, 0.0368072242f, 0.997290432f, 0.0735645667f,
+    0.993906975f, 0.110222206f, 0.999077737f, 0.0429382585f, 0.996312618f, 0.0857973099f, 0.991709769f, 0.128498107f,
+    0.99879545f, 0.0490676761f, 0.99518472f, 0.0980171412f, 0.989176512f, 0.146730468f, 0.998475552f, 0.0551952459f,
+    0.993906975f, 0.110222206f, 0.986308098f, 0.164913118f, 0.998118103f, 0.061320737f, 0.992479563f, 0.122410677f,
+    0.983105481f, 0.183039889f, 0.997723043f, 0.0674439222f, 0.990902662f, 0.134580702f, 0.979569793f, 0.201104641f,
+    0.997290432f, 0.0735645667f, 0.989176512f, 0.146730468f, 0.975702107f, 0.219101235f, 0.996820271f, 0.0796824396f,
+    0.987301409f, 0.15885815f, 0.971503913f, 0.237023607f, 0.996312618f, 0.0857973099f, 0.985277653f, 0.170961887f,
+    0.966976464f, 0.254865646f, 0.995767415f, 0.0919089541f, 0.983105481f, 0.183039889f, 0.962121427f, 0.272621363f,
+    0.99518472f, 0.0980171412f, 0.980785251f, 0.195090324f, 0.956940353f, 0.290284663f, 0.994564593f, 0.104121633f,
+    0.97831738f, 0.207111374f, 0.95143503f, 0.307849646f, 0.993906975f, 0.110222206f, 0.975702107f, 0.219101235f,
+    0.945607305f, 0.32531029f, 0.993211925f, 0.116318628f, 0.972939968f, 0.231058106f, 0.939459205f, 0.342660725f,
+    0.992479563f, 0.122410677f, 0.970031261f, 0.242980182f, 0.932992816f, 0.359895051f, 0.991709769f, 0.128498107f,
+    0.966976464f, 0.254865646f, 0.926210225f, 0.377007425f, 0.990902662f, 0.134580702f, 0.963776052f, 0.266712755f,
+    0.919113874f, 0.393992037f, 0.990058184f, 0.140658244f, 0.960430503f, 0.27851969f, 0.91170603f, 0.410843164f,
+    0.989176512f, 0.146730468f, 0.956940353f, 0.290284663f, 0.903989315f, 0.427555084f, 0.988257587f, 0.152797192f,
+    0.953306019f, 0.302005947f, 0.895966232f, 0.444122136f, 0.987301409f, 0.15885815f, 0.949528158f, 0.313681751f,
+    0.887639642f, 0.460538715f, 0.986308098f, 0.164913118f, 0.945607305f, 0.32531029f, 0.879012227f, 0.47679922f,
+    0.985277653f, 0.170961887f, 0.941544056f, 0.336889863f, 0.870086968f, 0.492898196f, 0.984210074f, 0.177004218f,
+    0.937339008f, 0.348418683f, 0.860866964f, 0.50883013f, 0.983105481f, 0.183039889f, 0.932992816f, 0.359895051f,
+    0.851355195f, 0.524589658f, 0.981963873f, 0.18906866f, 0.928506076f, 0.371317208f, 0.841554999f, 0.540171444f,
+    0.980785251f, 0.195090324f, 0.923879504f, 0.382683426f, 0.831469595f, 0.555570245f, 0.979569793f, 0.201104641f,
+    0.919113874f, 0.393992037f, 0.8211025f, 0.570780754f, 0.97831738f, 0.207111374f, 0.914209783f, 0.405241311f,
+    0.81045717f, 0.585797846f, 0.977028131f, 0.213110313f, 0.909168005f, 0.416429549f, 0.799537241f, 0.600616455f,
+    0.975702107f, 0.219101235f, 0.903989315f, 0.427555084f, 0.78834641f, 0.615231574f, 0.974339366f, 0.225083917f,
+    0.898674488f, 0.438616246f, 0.77688849f, 0.629638255f, 0.972939968f, 0.231058106f, 0.893224299f, 0.449611336f,
+    0.765167236f, 0.643831551f, 0.971503913f, 0.237023607f, 0.887639642f, 0.460538715f, 0.753186822f, 0.657806695f,
+    0.970031261f, 0.242980182f, 0.881921291f, 0.471396744f, 0.740951121f, 0.671558976f, 0.968522072f, 0.248927608f,
+    0.876070082f, 0.482183784f, 0.728464365f, 0.685083687f, 0.966976464f, 0.254865646f, 0.870086968f, 0.492898196f,
+    0.715730846f, 0.698376238f, 0.965394437f, 0.260794103f, 0.863972843f, 0.50353837f, 0.702754736f, 0.711432219f,
+    0.963776052f, 0.266712755f, 0.857728601f, 0.514102757f, 0.689540565f, 0.724247098f, 0.962121427f, 0.272621363f,
+    0.851355195f, 0.524589658f, 0.676092684f, 0.736816585f, 0.960430503f, 0.27851969f, 0.84485358f, 0.534997642f,
+    0.662415802f, 0.749136388f, 0.958703458f, 0.284407526f, 0.838224709f, 0.545324981f, 0.64851439f, 0.761202395f,
+    0.956940353f, 0.290284663f, 0.831469595f, 0.555570245f, 0.634393275f, 0.773010433f, 0.955141187f, 0.296150893f,
+    0.824589312f, 0.565731823f, 0.620057225f, 0.784556568f, 0.953306019f, 0.302005947f, 0.817584813f, 0.575808167f,
+    0.605511069f, 0.795836926f, 0.95143503f, 0.307849646f, 0.81045717f, 0.585797846f, 0.590759695f, 0.806847572f,
+    0.949528158f, 0.313681751f, 0.803207517f, 0.59569931f, 0.575808167f, 0.817584813f, 0.947585583f, 0.319502026f,
+    0.795836926f, 0.605511069f, 0.560661554f, 0.82804507f, 0.945607305f, 0.32531029f, 0.78834641f, 0.615231574f,
+    0.545324981f, 0.838224709f, 0.943593442f, 0.331106305f, 0.780737221f, 0.624859512f, 0.529803634f, 0.848120332f,
+    0.941544056f, 0.336889863f, 0.773010433f, 0.634393275f, 0.514102757f, 0.857728601f, 0.939459205f, 0.342660725f,
+    0.765167236f, 0.643831551f, 0.498227656f, 0.867046237f, 0.937339008f, 0.348418683f, 0.757208824f, 0.653172851f,
+    0.482183784f, 0.876070082f, 0.935183525f, 0.354163527f, 0.749136388f, 0.662415802f, 0.465976506f, 0.884797096f,
+    0.932992816f, 0.359895051f, 0.740951121f, 0.671558976f, 0.449611336f, 0.893224299f, 0.93076694f, 0.365612984f,
+    0.732654274f, 0.680601001f, 0.433093816f, 0.901348829f, 0.928506076f, 0.371317208f, 0.724247098f, 0.689540565f,
+    0.416429549f, 0.909168005f, 0.926210225f, 0.377007425f, 0.715730846f, 0.698376238f, 0.399624199f, 0.916679084f,
+    0.923879504f, 0.382683426f, 0.707106769f, 0.707106769f, 0.382683426f, 0.923879504f, 0.921514034f, 0.388345033f,
+    0.698376238f, 0.715730846f, 0.365612984f, 0.93076694f, 0.919113874f, 0.393992037f, 0.689540565f, 0.724247098f,
+    0.348418683f, 0.937339008f, 0.916679084f, 0.399624199f, 0.680601001f, 0.732654274f, 0.331106305f, 0.943593442f,
+    0.914209783f, 0.405241311f, 0.671558976f, 0.740951121f, 0.313681751f, 0.949528158f, 0.91170603f, 0.410843164f,
+    0.662415802f, 0.749136388f, 0.296150893f, 0.955141187f, 0.909168005f, 0.416429549f, 0.653172851f, 0.757208824f,
+    0.27851969f, 0.960430503f, 0.906595707f, 0.422000259f, 0.643831551f, 0.765167236f, 0.260794103f, 0.965394437f,
+    0.903989315f, 0.427555084f, 0.634393275f, 0.773010433f, 0.242980182f, 0.970031261f, 0.901348829f, 0.433093816f,
+    0.624859512f, 0.780737221f, 0.225083917f, 0.974339366f, 0.898674488f, 0.438616246f, 0.615231574f, 0.78834641f,
+    0.207111374f, 0.97831738f, 0.895966232f, 0.444122136f, 0.605511069f, 0.795836926f, 0.18906866f, 0.981963873f,
+    0.893224299f, 0.449611336f, 0.59569931f, 0.803207517f, 0.170961887f, 0.985277653f, 0.890448749f, 0.455083579f,
+    0.585797846f, 0.81045717f, 0.152797192f, 0.988257587f, 0.887639642f, 0.460538715f, 0.575808167f, 0.817584813f,
+    0.134580702f, 0.990902662f, 0.884797096f, 0.465976506f, 0.565731823f, 0.824589312f, 0.116318628f, 0.993211925f,
+    0.881921291f, 0.471396744f, 0.555570245f, 0.831469595f, 0.0980171412f, 0.99518472f, 0.879012227f, 0.47679922f,
+    0.545324981f, 0.838224709f, 0.0796824396f, 0.996820271f, 0.876070082f, 0.482183784f, 0.534997642f, 0.84485358f,
+    0.061320737f, 0.998118103f, 0.873094976f, 0.487550169f, 0.524589658f, 0.851355195f, 0.0429382585f, 0.999077737f,
+    0.870086968f, 0.492898196f, 0.514102757f, 0.857728601f, 0.024541229f, 0.999698818f, 0.867046237f, 0.498227656f,
+    0.50353837f, 0.863972843f, 0.00613588467f, 0.999981165f, 0.863972843f, 0.50353837f, 0.492898196f, 0.870086968f,
+    -0.0122715384f, 0.999924719f, 0.860866964f, 0.50883013f, 0.482183784f, 0.876070082f, -0.030674804f, 0.999529421f,
+    0.857728601f, 0.514102757f, 0.471396744f, 0.881921291f, -0.0490676761f, 0.99879545f, 0.854557991f, 0.519356012f,
+    0.460538715f, 0.887639642f, -0.0674439222f, 0.997723043f, 0.851355195f, 0.524589658f, 0.449611336f, 0.893224299f,
+    -0.0857973099f, 0.996312618f, 0.848120332f, 0.529803634f, 0.438616246f, 0.898674488f, -0.104121633f, 0.994564593f,
+    0.84485358f, 0.534997642f, 0.427555084f, 0.903989315f, -0.122410677f, 0.992479563f, 0.841554999f, 0.540171444f,
+    0.416429549f, 0.909168005f, -0.140658244f, 0.990058184f, 0.838224709f, 0.545324981f, 0.405241311f, 0.914209783f,
+    -0.15885815f, 0.987301409f, 0.834862888f, 0.550457954f, 0.393992037f, 0.919113874f, -0.177004218f, 0.984210074f,
+    0.831469595f, 0.555570245f, 0.382683426f, 0.923879504f, -0.195090324f, 0.980785251f, 0.82804507f, 0.560661554f,
+    0.371317208f, 0.928506076f, -0.213110313f, 0.977028131f, 0.824589312f, 0.565731823f, 0.359895051f, 0.932992816f,
+    -0.231058106f, 0.972939968f, 0.8211025f, 0.570780754f, 0.348418683f, 0.937339008f, -0.248927608f, 0.968522072f,
+    0.817584813f, 0.575808167f, 0.336889863f, 0.941544056f, -0.266712755f, 0.963776052f, 0.81403631f, 0.580813944f,
+    0.32531029f, 0.945607305f, -0.284407526f, 0.958703458f, 0.81045717f, 0.585797846f, 0.313681751f, 0.949528158f,
+    -0.302005947f, 0.953306019f, 0.806847572f, 0.590759695f, 0.302005947f, 0.953306019f, -0.319502026f, 0.947585583f,
+    0.803207517f, 0.59569931f, 0.290284663f, 0.956940353f, -0.336889863f, 0.941544056f, 0.799537241f, 0.600616455f,
+    0.27851969f, 0.960430503f, -0.354163527f, 0.935183525f, 0.795836926f, 0.605511069f, 0.266712755f, 0.963776052f,
+    -0.371317208f, 0.928506076f, 0.792106569f, 0.610382795f, 0.254865646f, 0.966976464f, -0.388345033f, 0.921514034f,
+    0.78834641f, 0.615231574f, 0.242980182f, 0.970031261f, -0.405241311f, 0.914209783f, 0.784556568f, 0.620057225f,
+    0.231058106f, 0.972939968f, -0.422000259f, 0.906595707f, 0.780737221f, 0.624859512f, 0.219101235f, 0.975702107f,
+    -0.438616246f, 0.898674488f, 0.77688849f, 0.629638255f, 0.207111374f, 0.97831738f, -0.455083579f, 0.890448749f,
+    0.773010433f, 0.634393275f, 0.195090324f, 0.980785251f, -0.471396744f, 0.881921291f, 0.769103348f, 0.639124453f,
+    0.183039889f, 0.983105481f, -0.487550169f, 0.873094976f, 0.765167236f, 0.643831551f, 0.170961887f, 0.985277653f,
+    -0.50353837f, 0.863972843f, 0.761202395f, 0.64851439f, 0.15885815f, 0.987301409f, -0.519356012f, 0.854557991f,
+    0.757208824f, 0.653172851f, 0.146730468f, 0.989176512f, -0.534997642f, 0.84485358f, 0.753186822f, 0.657806695f,
+    0.134580702f, 0.990902662f, -0.550457954f, 0.834862888f, 0.749136388f, 0.662415802f, 0.122410677f, 0.992479563f,
+    -0.565731823f, 0.824589312f, 0.745057762f, 0.666999936f, 0.110222206f, 0.993906975f, -0.580813944f, 0.81403631f,
+    0.740951121f, 0.671558976f, 0.0980171412f, 0.99518472f, -0.59569931f, 0.803207517f, 0.736816585f, 0.676092684f,
+    0.0857973099f, 0.996312618f, -0.610382795f, 0.792106569f, 0.732654274f, 0.680601001f, 0.0735645667f, 0.997290432f,
+    -0.624859512f, 0.780737221f, 0.728464365f, 0.685083687f, 0.061320737f, 0.998118103f, -0.639124453f, 0.769103348f,
+    0.724247098f, 0.689540565f, 0.0490676761f, 0.99879545f, -0.653172851f, 0.757208824f, 0.720002532f, 0.693971455f,
+    0.0368072242f, 0.999322355f, -0.666999936f, 0.745057762f, 0.715730846f, 0.698376238f, 0.024541229f, 0.999698818f,
+    -0.680601001f, 0.732654274f, 0.711432219f, 0.702754736f, 0.0122715384f, 0.999924719f, -0.693971455f, 0.720002532f,
+    0.707106769f, 0.707106769f, 6.12323426e-17f, 1.0f, -0.707106769f, 0.707106769f, 0.702754736f, 0.711432219f,
+    -0.0122715384f, 0.999924719f, -0.720002532f, 0.693971455f, 0.698376238f, 0.715730846f, -0.024541229f, 0.999698818f,
+    -0.732654274f, 0.680601001f, 0.693971455f, 0.720002532f, -0.0368072242f, 0.999322355f, -0.745057762f, 0.666999936f,
+    0.689540565f, 0.724247098f, -0.0490676761f, 0.99879545f, -0.757208824f, 0.653172851f, 0.685083687f, 0.728464365f,
+    -0.061320737f, 0.998118103f, -0.769103348f, 0.639124453f, 0.680601001f, 0.732654274f, -0.0735645667f, 0.997290432f,
+    -0.780737221f, 0.624859512f, 0.676092684f, 0.736816585f, -0.0857973099f, 0.996312618f, -0.792106569f, 0.610382795f,
+    0.671558976f, 0.740951121f, -0.0980171412f, 0.99518472f, -0.803207517f, 0.59569931f, 0.666999936f, 0.745057762f,
+    -0.110222206f, 0.993906975f, -0.81403631f, 0.580813944f, 0.662415802f, 0.749136388f, -0.122410677f, 0.992479563f,
+    -0.824589312f, 0.565731823f, 0.657806695f, 0.753186822f, -0.134580702f, 0.990902662f, -0.834862888f, 0.550457954f,
+    0.653172851f, 0.757208824f, -0.146730468f, 0.989176512f, -0.84485358f, 0.534997642f, 0.64851439f, 0.761202395f,
+    -0.15885815f, 0.987301409f, -0.854557991f, 0.519356012f, 0.643831551f, 0.765167236f, -0.170961887f, 0.985277653f,
+    -0.863972843f, 0.50353837f, 0.639124453f, 0.769103348f, -0.183039889f, 0.983105481f, -0.873094976f, 0.487550169f,
+    0.634393275f, 0.773010433f, -0.195090324f, 0.980785251f, -0.881921291f, 0.471396744f, 0.629638255f, 0.77688849f,
+    -0.207111374f, 0.97831738f, -0.890448749f, 0.455083579f, 0.624859512f, 0.780737221f, -0.219101235f, 0.975702107f,
+    -0.898674488f, 0.438616246f, 0.620057225f, 0.784556568f, -0.231058106f, 0.972939968f, -0.906595707f, 0.422000259f,
+    0.615231574f, 0.78834641f, -0.242980182f, 0.970031261f, -0.914209783f, 0.405241311f, 0.610382795f, 0.792106569f,
+    -0.254865646f, 0.966976464f, -0.921514034f, 0.388345033f, 0.605511069f, 0.795836926f, -0.266712755f, 0.963776052f,
+    -0.928506076f, 0.371317208f, 0.600616455f, 0.799537241f, -0.27851969f, 0.960430503f, -0.935183525f, 0.354163527f,
+    0.59569931f, 0.803207517f, -0.290284663f, 0.956940353f, -0.941544056f, 0.336889863f, 0.590759695f, 0.806847572f,
+    -0.302005947f, 0.953306019f, -0.947585583f, 0.319502026f, 0.585797846f, 0.81045717f, -0.313681751f, 0.949528158f,
+    -0.953306019f, 0.302005947f, 0.580813944f, 0.81403631f, -0.32531029f, 0.945607305f, -0.958703458f, 0.284407526f,
+    0.575808167f, 0.817584813f, -0.336889863f, 0.941544056f, -0.963776052f, 0.266712755f, 0.570780754f, 0.8211025f,
+    -0.348418683f, 0.937339008f, -0.968522072f, 0.248927608f, 0.565731823f, 0.824589312f, -0.359895051f, 0.932992816f,
+    -0.972939968f, 0.231058106f, 0.560661554f, 0.82804507f, -0.371317208f, 0.928506076f, -0.977028131f, 0.213110313f,
+    0.555570245f, 0.831469595f, -0.382683426f, 0.923879504f, -0.980785251f, 0.195090324f, 0.550457954f, 0.834862888f,
+    -0.393992037f, 0.919113874f, -0.984210074f, 0.177004218f, 0.545324981f, 0.838224709f, -0.405241311f, 0.914209783f,
+    -0.987301409f, 0.15885815f, 0.540171444f, 0.841554999f, -0.416429549f, 0.909168005f, -0.990058184f, 0.140658244f,
+    0.534997642f, 0.84485358f, -0.427555084f, 0.903989315f, -0.992479563f, 0.122410677f, 0.529803634f, 0.848120332f,
+    -0.438616246f, 0.898674488f, -0.994564593f, 0.104121633f, 0.524589658f, 0.851355195f, -0.449611336f, 0.893224299f,
+    -0.996312618f, 0.0857973099f, 0.519356012f, 0.854557991f, -0.460538715f, 0.887639642f, -0.997723043f, 0.0674439222f,
+    0.514102757f, 0.857728601f, -0.471396744f, 0.881921291f, -0.99879545f, 0.0490676761f, 0.50883013f, 0.860866964f,
+    -0.482183784f, 0.876070082f, -0.999529421f, 0.030674804f, 0.50353837f, 0.863972843f, -0.492898196f, 0.870086968f,
+    -0.999924719f, 0.0122715384f, 0.498227656f, 0.867046237f, -0.50353837f, 0.863972843f, -0.999981165f, -0.00613588467f,
+    0.492898196f, 0.870086968f, -0.514102757f, 0.857728601f, -0.999698818f, -0.024541229f, 0.487550169f, 0.873094976f,
+    -0.524589658f, 0.851355195f, -0.999077737f, -0.0429382585f, 0.482183784f, 0.876070082f, -0.534997642f, 0.84485358f,
+    -0.998118103f, -0.061320737f, 0.47679922f, 0.879012227f, -0.545324981f, 0.838224709f, -0.996820271f, -0.0796824396f,
+    0.471396744f, 0.881921291f, -0.555570245f, 0.831469595f, -0.99518472f, -0.0980171412f, 0.465976506f, 0.884797096f,
+    -0.565731823f, 0.824589312f, -0.993211925f, -0.116318628f, 0.460538715f, 0.887639642f, -0.575808167f, 0.817584813f,
+    -0.990902662f, -0.134580702f, 0.455083579f, 0.890448749f, -0.585797846f, 0.81045717f, -0.988257587f, -0.152797192f,
+    0.449611336f, 0.893224299f, -0.59569931f, 0.803207517f, -0.985277653f, -0.170961887f, 0.444122136f, 0.895966232f,
+    -0.605511069f, 0.795836926f, -0.981963873f, -0.18906866f, 0.438616246f, 0.898674488f, -0.615231574f, 0.78834641f,
+    -0.97831738f, -0.207111374f, 0.433093816f, 0.901348829f, -0.624859512f, 0.780737221f, -0.974339366f, -0.225083917f,
+    0.427555084f, 0.903989315f, -0.634393275f, 0.773010433f, -0.970031261f, -0.242980182f, 0.422000259f, 0.906595707f,
+    -0.643831551f, 0.765167236f, -0.965394437f, -0.260794103f, 0.416429549f, 0.909168005f, -0.653172851f, 0.757208824f,
+    -0.960430503f, -0.27851969f, 0.410843164f, 0.91170603f, -0.662415802f, 0.749136388f, -0.955141187f, -0.296150893f,
+    0.405241311f, 0.914209783f, -0.671558976f, 0.740951121f, -0.949528158f, -0.313681751f, 0.399624199f, 0.916679084f,
+    -0.680601001f, 0.732654274f, -0.943593442f, -0.331106305f, 0.393992037f, 0.919113874f, -0.689540565f, 0.724247098f,
+    -0.937339008f, -0.348418683f, 0.388345033f, 0.921514034f, -0.698376238f, 0.715730846f, -0.93076694f, -0.365612984f,
+    0.382683426f, 0.923879504f, -0.707106769f, 0.707106769f, -0.923879504f, -0.382683426f, 0.377007425f, 0.926210225f,
+    -0.715730846f, 0.698376238f, -0.916679084f, -0.399624199f, 0.371317208f, 0.928506076f, -0.724247098f, 0.689540565f,
+    -0.909168005f, -0.416429549f, 0.365612984f, 0.93076694f, -0.732654274f, 0.680601001f, -0.901348829f, -0.433093816f,
+    0.359895051f, 0.932992816f, -0.740951121f, 0.671558976f, -0.893224299f, -0.449611336f, 0.354163527f, 0.935183525f,
+    -0.749136388f, 0.662415802f, -0.884797096f, -0.465976506f, 0.348418683f, 0.937339008f, -0.757208824f, 0.653172851f,
+    -0.876070082f, -0.482183784f, 0.342660725f, 0.939459205f, -0.765167236f, 0.643831551f, -0.867046237f, -0.498227656f,
+    0.336889863f, 0.941544056f, -0.773010433f, 0.634393275f, -0.857728601f, -0.514102757f, 0.331106305f, 0.943593442f,
+    -0.780737221f, 0.624859512f, -0.848120332f, -0.529803634f, 0.32531029f, 0.945607305f, -0.78834641f, 0.615231574f,
+    -0.838224709f, -0.545324981f, 0.319502026f, 0.947585583f, -0.795836926f, 0.605511069f, -0.82804507f, -0.560661554f,
+    0.313681751f, 0.949528158f, -0.803207517f, 0.59569931f, -0.817584813f, -0.575808167f, 0.307849646f, 0.95143503f,
+    -0.81045717f, 0.585797846f, -0.806847572f, -0.590759695f, 0.302005947f, 0.953306019f, -0.817584813f, 0.575808167f,
+    -0.795836926f, -0.605511069f, 0.296150893f, 0.955141187f, -0.824589312f, 0.565731823f, -0.784556568f, -0.620057225f,
+    0.290284663f, 0.956940353f, -0.831469595f, 0.555570245f, -0.773010433f, -0.634393275f, 0.284407526f, 0.958703458f,
+    -0.838224709f, 0.545324981f, -0.761202395f, -0.64851439f, 0.27851969f, 0.960430503f, -0.84485358f, 0.534997642f,
+    -0.749136388f, -0.662415802f, 0.272621363f, 0.962121427f, -0.851355195f, 0.524589658f, -0.736816585f, -0.676092684f,
+    0.266712755f, 0.963776052f, -0.857728601f, 0.514102757f, -0.724247098f, -0.689540565f, 0.260794103f, 0.965394437f,
+    -0.863972843f, 0.50353837f, -0.711432219f, -0.702754736f, 0.254865646f, 0.966976464f, -0.870086968f, 0.492898196f,
+    -0.698376238f, -0.715730846f, 0.248927608f, 0.968522072f, -0.876070082f, 0.482183784f, -0.685083687f, -0.728464365f,
+    0.242980182f, 0.970031261f, -0.881921291f, 0.471396744f, -0.671558976f, -0.740951121f, 0.237023607f, 0.971503913f,
+    -0.887639642f, 0.460538715f, -0.657806695f, -0.753186822f, 0.231058106f, 0.972939968f, -0.893224299f, 0.449611336f,
+    -0.643831551f, -0.765167236f, 0.225083917f, 0.974339366f, -0.898674488f, 0.438616246f, -0.629638255f, -0.77688849f,
+    0.219101235f, 0.975702107f, -0.903989315f, 0.427555084f, -0.615231574f, -0.78834641f, 0.213110313f, 0.977028131f,
+    -0.909168005f, 0.416429549f, -0.600616455f, -0.799537241f, 0.207111374f, 0.97831738f, -0.914209783f, 0.405241311f,
+    -0.585797846f, -0.81045717f, 0.201104641f, 0.979569793f, -0.919113874f, 0.393992037f, -0.570780754f, -0.8211025f,
+    0.195090324f, 0.980785251f, -0.923879504f, 0.382683426f, -0.555570245f, -0.831469595f, 0.18906866f, 0.981963873f,
+    -0.928506076f, 0.371317208f, -0.540171444f, -0.841554999f, 0.183039889f, 0.983105481f, -0.932992816f, 0.359895051f,
+    -0.524589658f, -0.851355195f, 0.177004218f, 0.984210074f, -0.937339008f, 0.348418683f, -0.50883013f, -0.860866964f,
+    0.170961887f, 0.985277653f, -0.941544056f, 0.336889863f, -0.492898196f, -0.870086968f, 0.164913118f, 0.986308098f,
+    -0.945607305f, 0.32531029f, -0.47679922f, -0.879012227f, 0.15885815f, 0.987301409f, -0.949528158f, 0.313681751f,
+    -0.460538715f, -0.887639642f, 0.152797192f, 0.988257587f, -0.953306019f, 0.302005947f, -0.444122136f, -0.895966232f,
+    0.146730468f, 0.989176512f, -0.956940353f, 0.290284663f, -0.427555084f, -0.903989315f, 0.140658244f, 0.990058184f,
+    -0.960430503f, 0.27851969f, -0.410843164f, -0.91170603f, 0.134580702f, 0.990902662f, -0.963776052f, 0.266712755f,
+    -0.393992037f, -0.919113874f, 0.128498107f, 0.991709769f, -0.966976464f, 0.254865646f, -0.377007425f, -0.926210225f,
+    0.122410677f, 0.992479563f, -0.970031261f, 0.242980182f, -0.359895051f, -0.932992816f, 0.116318628f, 0.993211925f,
+    -0.972939968f, 0.231058106f, -0.342660725f, -0.939459205f, 0.110222206f, 0.993906975f, -0.975702107f, 0.219101235f,
+    -0.32531029f, -0.945607305f, 0.104121633f, 0.994564593f, -0.97831738f, 0.207111374f, -0.307849646f, -0.95143503f,
+    0.0980171412f, 0.99518472f, -0.980785251f, 0.195090324f, -0.290284663f, -0.956940353f, 0.0919089541f, 0.995767415f,
+    -0.983105481f, 0.183039889f, -0.272621363f, -0.962121427f, 0.0857973099f, 0.996312618f, -0.985277653f, 0.170961887f,
+    -0.254865646f, -0.966976464f, 0.0796824396f, 0.996820271f, -0.987301409f, 0.15885815f, -0.237023607f, -0.971503913f,
+    0.0735645667f, 0.997290432f, -0.989176512f, 0.146730468f, -0.219101235f, -0.975702107f, 0.0674439222f, 0.997723043f,
+    -0.990902662f, 0.134580702f, -0.201104641f, -0.979569793f, 0.061320737f, 0.998118103f, -0.992479563f, 0.122410677f,
+    -0.183039889f, -0.983105481f, 0.0551952459f, 0.998475552f, -0.993906975f, 0.110222206f, -0.164913118f, -0.986308098f,
+    0.0490676761f, 0.99879545f, -0.99518472f, 0.0980171412f, -0.146730468f, -0.989176512f, 0.0429382585f, 0.999077737f,
+    -0.996312618f, 0.0857973099f, -0.128498107f, -0.991709769f, 0.0368072242f, 0.999322355f, -0.997290432f, 0.0735645667f,
+    -0.110222206f, -0.993906975f, 0.030674804f, 0.999529421f, -0.998118103f, 0.061320737f, -0.0919089541f, -0.995767415f,
+    0.024541229f, 0.999698818f, -0.99879545f, 0.0490676761f, -0.0735645667f, -0.997290432f, 0.0184067301f, 0.999830604f,
+    -0.999322355f, 0.0368072242f, -0.0551952459f, -0.998475552f, 0.0122715384f, 0.999924719f, -0.999698818f, 0.024541229f,
+    -0.0368072242f, -0.999322355f, 0.00613588467f, 0.999981165f, -0.999924719f, 0.0122715384f, -0.0184067301f, -0.999830604f,
+};
+
+const int16_t fft_q15_twiddles_2048[3068] = {
+    32767, 0, 32767, 101, 32766, 201, 32766, 302,
+    32765, 402, 32763, 503, 32761, 603, 32759, 704,
+    32757, 804, 32755, 905, 32752, 1005, 32748, 1106,
+    32745, 1206, 32741, 1307, 32737, 1407, 32732, 1507,
+    32728, 1608, 32722, 1708, 32717, 1809, 32711, 1909,
+    32705, 2009, 32699, 2110, 32692, 2210, 32685, 2310,
+    32678, 2410, 32671, 2511, 32663, 2611, 32655, 2711,
+    32646, 2811, 32637, 2911, 32628, 3012, 32619, 3112,
+    32609, 3212, 32599, 3312, 32589, 3412, 32578, 3512,
+    32567, 3612, 32556, 3712, 32545, 3811, 32533, 3911,
+    32521, 4011, 32508, 4111, 32495, 4210, 32482, 4310,
+    32469, 4410, 32455, 4509, 32441, 4609, 32427, 4708,
+    32412, 4808, 32397, 4907, 32382, 5007, 32367, 5106,
+    32351, 5205, 32335, 5305, 32318, 5404, 32302, 5503,
+    32285, 5602, 32267, 5701, 32250, 5800, 32232, 5899,
+    32213, 5998, 32195, 6096, 32176, 6195, 32157, 6294,
+    32137, 6393, 32118, 6491, 32098, 6590, 32077, 6688,
+    32057, 6786, 32036, 6885, 32014, 6983, 31993, 7081,
+    31971, 7179, 31949, 7277, 31926, 7375, 31903, 7473,
+    31880, 7571, 31857, 7669, 31833, 7767, 31809, 7864,
+    31785, 7962, 31760, 8059, 31736, 8157, 31710, 8254,
+    31685, 8351, 31659, 8448, 31633, 8545, 31607, 8642,
+    31580, 8739, 31553, 8836, 31526, 8933, 31498, 9030,
+    31470, 9126, 31442, 9223, 31414, 9319, 31385, 9416,
+    31356, 9512, 31327, 9608, 31297, 9704, 31267, 9800,
+    31237, 9896, 31206, 9992, 31176, 10087, 31145, 10183,
+    31113, 10278, 31082, 10374, 31050, 10469, 31017, 10564,
+    30985, 10659, 30952, 10754, 30919, 10849, 30885, 10944,
+    30852, 11039, 30818, 11133, 30783, 11228, 30749, 11322,
+    30714, 11417, 30679, 11511, 30643, 11605, 30607, 11699,
+    30571, 11793, 30535, 11886, 30498, 11980, 30462, 12074,
+    30424, 12167, 30387, 12260, 30349, 12353, 30311, 12446,
+    30273, 12539, 30234, 12632, 30195, 12725, 30156, 12817,
+    30117, 12910, 30077, 13002, 30037, 13094, 29997, 13187,
+    29956, 13279, 29915, 13370, 29874, 13462, 29832, 13554,
+    29791, 13645, 29749, 13736, 29706, 13828, 29664, 13919,
+    29621, 14010, 29578, 14101, 29534, 14191, 29491, 14282,
+    29447, 14372, 29403, 14462, 29358, 14553, 29313, 14643,
+    29268, 14732, 29223, 14822, 29177, 14912, 29131, 15001,
+    29085, 15090, 29039, 15180, 28992, 15269, 28945, 15358,
+    28898, 15446, 28850, 15535, 28803, 15623, 28755, 15712,
+    28706, 15800, 28658, 15888, 28609, 15976, 28560, 16063,
+    28510, 16151, 28460, 16238, 28411, 16325, 28360, 16413,
+    28310, 16499, 28259, 16586, 28208, 16673, 28157, 16759,
+    28105, 16846, 28053, 16932, 28001, 17018, 27949, 17104,
+    27896, 17189, 27843, 17275, 27790, 17360, 27737, 17445,
+    27683, 17530, 27629, 17615, 27575, 17700, 27521, 17784,
+    27466, 17869, 27411, 17953, 27356, 18037, 27300, 18121,
+    27245, 18204, 27189, 18288, 27133, 18371, 27076, 18454,
+    27019, 18537, 26962, 18620, 26905, 18703, 26848, 18785,
+    26790, 18868, 26732, 18950, 26674, 19032, 26615, 19113,
+    26556, 19195, 26497, 19276, 26438, 19357, 26378, 19438,
+    26319, 19519, 26259, 19600, 26198, 19680, 26138, 19761,
+    26077, 19841, 26016, 19921, 25955, 20000, 25893, 20080,
+    25832, 20159, 25770, 20238, 25708, 20317, 25645, 20396,
+    25582, 20475, 25519, 20553, 25456, 20631, 25393, 20709,
+    25329, 20787, 25265, 20865, 25201, 20942, 25137, 21019,
+    25072, 21096, 25007, 21173, 24942, 21250, 24877, 21326,
+    24811, 21403, 24746, 21479, 24680, 21554, 24613, 21630,
+    24547, 21705, 24480, 21781, 24413, 21856, 24346, 21930,
+    24279, 22005, 24211, 22079, 24143, 22154, 24075, 22227,
+    24007, 22301, 23938, 22375, 23870, 22448, 23801, 22521,
+    23731, 22594, 23662, 22667, 23592, 22739, 23522, 22812,
+    23452, 22884, 23382, 22956, 23311, 23027, 23241, 23099,
+    23170, 23170, 23099, 23241, 23027, 23311, 22956, 23382,
+    22884, 23452, 22812, 23522, 22739, 23592, 22667, 23662,
+    22594, 23731, 22521, 23801, 22448, 23870, 22375, 23938,
+    22301, 24007, 22227, 24075, 22154, 24143, 22079, 24211,
+    22005, 24279, 21930, 24346, 21856, 24413, 21781, 24480,
+    21705, 24547, 21630, 24613, 21554, 24680, 21479, 24746,
+    21403, 24811, 21326, 24877, 21250, 24942, 21173, 25007,
+    21096, 25072, 21019, 25137, 20942, 25201, 20865, 25265,
+    20787, 25329, 20709, 25393, 20631, 25456, 20553, 25519,
+    20475, 25582, 20396, 25645, 20317, 25708, 20238, 25770,
+    20159, 25832, 20080, 25893, 20000, 25955, 19921, 26016,
+    19841, 26077, 19761, 26138, 19680, 26198, 19600, 26259,
+    19519, 26319, 19438, 26378, 19357, 26438, 19276, 26497,
+    19195, 26556, 19113, 26615, 19032, 26674, 18950, 26732,
+    18868, 26790, 18785, 26848, 18703, 26905, 18620, 26962,
+    18537, 27019, 18454, 27076, 18371, 27133, 18288, 27189,
+    18204, 27245, 18121, 27300, 18037, 27356, 17953, 27411,
+    17869, 27466, 17784, 27521, 17700, 27575, 17615, 27629,
+    17530, 27683, 17445, 27737, 17360, 27790, 17275, 27843,
+    17189, 27896, 17104, 27949, 17018, 28001, 16932, 28053,
+    16846, 28105, 16759, 28157, 16673, 28208, 16586, 28259,
+    16499, 28310, 16413, 28360, 16325, 28411, 16238, 28460,
+    16151, 28510, 16063, 28560, 15976, 28609, 15888, 28658,
+    15800, 28706, 15712, 28755, 15623, 28803, 15535, 28850,
+    15446, 28898, 15358, 28945, 15269, 28992, 15180, 29039,
+    15090, 29085, 15001, 29131, 14912, 29177, 14822, 29223,
+    14732, 29268, 14643, 29313, 14553, 29358, 14462, 29403,
+    14372, 29447, 14282, 29491, 14191, 29534, 14101, 29578,
+    14010, 29621, 13919, 29664, 13828, 29706, 13736, 29749,
+    13645, 29791, 13554, 29832, 13462, 29874, 13370, 29915,
+    13279, 29956, 13187, 29997, 13094, 30037, 13002, 30077,
+    12910, 30117, 12817, 30156, 12725, 30195, 12632, 30234,
+    12539, 30273, 12446, 30311, 12353, 30349, 12260, 30387,
+    12167, 30424, 12074, 30462, 11980, 30498, 11886, 30535,
+    11793, 30571, 11699, 30607, 11605, 30643, 11511, 30679,
+    11417, 30714, 11322, 30749, 11228, 30783, 11133, 30818,
+    11039, 30852, 10944, 30885, 10849, 30919, 10754, 30952,
+    10659, 30985, 10564, 31017, 10469, 31050, 10374, 31082,
+    10278, 31113, 10183, 31145, 10087, 31176, 9992, 31206,
+    9896, 31237, 9800, 31267, 9704, 31297, 9608, 31327,
+    9512, 31356, 9416, 31385, 9319, 31414, 9223, 31442,
+    9126, 31470, 9030, 31498, 8933, 31526, 8836, 31553,
+    8739, 31580, 8642, 31607, 8545, 31633, 8448, 31659,
+    8351, 31685, 8254, 31710, 8157, 31736, 8059, 31760,
+    7962, 31785, 7864, 31809, 7767, 31833, 7669, 31857,
+    7571, 31880, 7473, 31903, 7375, 31926, 7277, 31949,
+    7179, 31971, 7081, 31993, 6983, 32014, 6885, 32036,
+    6786, 32057, 6688, 32077, 6590, 32098, 6491, 32118,
+    6393, 32137, 6294, 32157, 6195, 32176, 6096, 32195,
+    5998, 32213, 5899, 32232, 5800, 32250, 5701, 32267,
+    5602, 32285, 5503, 32302, 5404, 32318, 5305, 32335,
+    5205, 32351, 5106, 32367, 5007, 32382, 4907, 32397,
+    4808, 32412, 4708, 32427, 4609, 32441, 4509, 32455,
+    4410, 32469, 4310, 32482, 4210, 32495, 4111, 32508,
+    4011, 32521, 3911, 32533, 3811, 32545, 3712, 32556,
+    3612, 32567, 3512, 32578, 3412, 32589, 3312, 32599,
+    3212, 32609, 3112, 32619, 3012, 32628, 2911, 32637,
+    2811, 32646, 2711, 32655, 2611, 32663, 2511, 32671,
+    2410, 32678, 2310, 32685, 2210, 32692, 2110, 32699,
+    2009, 32705, 1909, 32711, 1809, 32717, 1708, 32722,
+    1608, 32728, 1507, 32732, 1407, 32737, 1307, 32741,
+    1206, 32745, 1106, 32748, 1005, 32752, 905, 32755,
+    804, 32757, 704, 32759, 603, 32761, 503, 32763,
+    402, 32765, 302, 32766, 201, 32766, 101, 32767,
+    32767, 0, 0, 32767, 32767, 0, 23170, 23170,
+    0, 32767, -23170, 23170, 32767, 0, 30273, 12539,
+    23170, 23170, 12539, 30273, 0, 32767, -12539, 30273,
+    -23170, 23170, -30273, 12539, 32767, 0, 32137, 6393,
+    30273, 12539, 27245, 18204, 23170, 23170, 18204, 27245,
+    12539, 30273, 6393, 32137, 0, 32767, -6393, 32137,
+    -12539, 30273, -18204, 27245, -23170, 23170, -27245, 18204,
+    -30273, 12539, -32137, 6393, 32767, 0, 32609, 3212,
+    32137, 6393, 31356, 9512, 30273, 12539, 28898, 15446,
+    27245, 18204, 25329, 20787, 23170, 23170, 20787, 25329,
+    18204, 27245, 15446, 28898, 12539, 30273, 9512, 31356,
+    6393, 32137, 3212, 32609, 0, 32767, -3212, 32609,
+    -6393, 32137, -9512, 31356, -12539, 30273, -15446, 28898,
+    -18204, 27245, -20787, 25329, -23170, 23170, -25329, 20787,
+    -27245, 18204, -28898, 15446, -30273, 12539, -31356, 9512,
+    -32137, 6393, -32609, 3212, 32767, 0, 32728, 1608,
+    32609, 3212, 32412, 4808, 32137, 6393, 31785, 7962,
+    31356, 9512, 30852, 11039, 30273, 12539, 29621, 14010,
+    28898, 15446, 28105, 16846, 27245, 18204, 26319, 19519,
+    25329, 20787, 24279, 22005, 23170, 23170, 22005, 24279,
+    20787, 25329, 19519, 26319, 18204, 27245, 16846, 28105,
+    15446, 28898, 14010, 29621, 12539, 30273, 11039, 30852,
+    9512, 31356, 7962, 31785, 6393, 32137, 4808, 32412,
+    3212, 32609, 1608, 32728, 0, 32767, -1608, 32728,
+    -3212, 32609, -4808, 32412, -6393, 32137, -7962, 31785,
+    -9512, 31356, -11039, 30852, -12539, 30273, -14010, 29621,
+    -15446, 28898, -16846, 28105, -18204, 27245, -19519, 26319,
+    -20787, 25329, -22005, 24279, -23170, 23170, -24279, 22005,
+    -25329, 20787, -26319, 19519, -27245, 18204, -28105, 16846,
+    -28898, 15446, -29621, 14010, -30273, 12539, -30852, 11039,
+    -31356, 9512, -31785, 7962, -32137, 6393, -32412, 4808,
+    -32609, 3212, -32728, 1608, 32767, 0, 32757, 804,
+    32728, 1608, 32678, 2410, 32609, 3212, 32521, 4011,
+    32412, 4808, 32285, 5602, 32137, 6393, 31971, 7179,
+    31785, 7962, 31580, 8739, 31356, 9512, 31113, 10278,
+    30852, 11039, 30571, 11793, 30273, 12539, 29956, 13279,
+    29621, 14010, 29268, 14732, 28898, 15446, 28510, 16151,
+    28105, 16846, 27683, 17530, 27245, 18204, 26790, 18868,
+    26319, 19519, 25832, 20159, 25329, 20787, 24811, 21403,
+    24279, 22005, 23731, 22594, 23170, 23170, 22594, 23731,
+    22005, 24279, 21403, 24811, 20787, 25329, 20159, 25832,
+    19519, 26319, 18868, 26790, 18204, 27245, 17530, 27683,
+    16846, 28105, 16151, 28510, 15446, 28898, 14732, 29268,
+    14010, 29621, 13279, 29956, 12539, 30273, 11793, 30571,
+    11039, 30852, 10278, 31113, 9512, 31356, 8739, 31580,
+    7962, 31785, 7179, 31971, 6393, 32137, 5602, 32285,
+    4808, 32412, 4011, 32521, 3212, 32609, 2410, 32678,
+    1608, 32728, 804, 32757, 0, 32767, -804, 32757,
+    -1608, 32728, -2410, 32678, -3212, 32609, -4011, 32521,
+    -4808, 32412, -5602, 32285, -6393, 32137, -7179, 31971,
+    -7962, 31785, -8739, 31580, -9512, 31356, -10278, 31113,
+    -11039, 30852, -11793, 30571, -12539, 30273, -13279, 29956,
+    -14010, 29621, -14732, 29268, -15446, 28898, -16151, 28510,
+    -16846, 28105, -17530, 27683, -18204, 27245, -18868, 26790,
+    -19519, 26319, -20159, 25832, -20787, 25329, -21403, 24811,
+    -22005, 24279, -22594, 23731, -23170, 23170, -23731, 22594,
+    -24279, 22005, -24811, 21403, -25329, 20787, -25832, 20159,
+    -26319, 19519, -26790, 18868, -27245, 18204, -27683, 17530,
+    -28105, 16846, -28510, 16151, -28898, 15446, -29268, 14732,
+    -29621, 14010, -29956, 13279, -30273, 12539, -30571, 11793,
+    -30852, 11039, -31113, 10278, -31356, 9512, -31580, 8739,
+    -31785, 7962, -31971, 7179, -32137, 6393, -32285, 5602,
+    -32412, 4808, -32521, 4011, -32609, 3212, -32678, 2410,
+    -32728, 1608, -32757, 804, 32767, 0, 32765, 402,
+    32757, 804, 32745, 1206, 32728, 1608, 32705, 2009,
+    32678, 2410, 32646, 2811, 32609, 3212, 32567, 3612,
+    32521, 4011, 32469, 4410, 32412, 4808, 32351, 5205,
+    32285, 5602, 32213, 5998, 32137, 6393, 32057, 6786,
+    31971, 7179, 31880, 7571, 31785, 7962, 31685, 8351,
+    31580, 8739, 31470, 9126, 31356, 9512, 31237, 9896,
+    31113, 10278, 30985, 10659, 30852, 11039, 30714, 11417,
+    30571, 11793, 30424, 12167, 30273, 12539, 30117, 12910,
+    29956, 13279, 29791, 13645, 29621, 14010, 29447, 14372,
+    29268, 14732, 29085, 15090, 28898, 15446, 28706, 15800,
+    28510, 16151, 28310, 16499, 28105, 16846, 27896, 17189,
+    27683, 17530, 27466, 17869, 27245, 18204, 27019, 18537,
+    26790, 18868, 26556, 19195, 26319, 19519, 26077, 19841,
+    25832, 20159, 25582, 20475, 25329, 20787, 25072, 21096,
+    24811, 21403, 24547, 21705, 24279, 22005, 24007, 22301,
+    23731, 22594, 23452, 22884, 23170, 23170, 22884, 23452,
+    22594, 23731, 22301, 24007, 22005, 24279, 21705, 24547,
+    21403, 24811, 21096, 25072, 20787, 25329, 20475, 25582,
+    20159, 25832, 19841, 26077, 19519, 26319, 19195, 26556,
+    18868, 26790, 18537, 27019, 18204, 27245, 17869, 27466,
+    17530, 27683, 17189, 27896, 16846, 28105, 16499, 28310,
+    16151, 28510, 15800, 28706, 15446, 28898, 15090, 29085,
+    14732, 29268, 14372, 29447, 14010, 29621, 13645, 29791,
+    13279, 29956, 12910, 30117, 12539, 30273, 12167, 30424,
+    11793, 30571, 11417, 30714, 11039, 30852, 10659, 30985,
+    10278, 31113, 9896, 31237, 9512, 31356, 9126, 31470,
+    8739, 31580, 8351, 31685, 7962, 31785, 7571, 31880,
+    7179, 31971, 6786, 32057, 6393, 32137, 5998, 32213,
+    5602, 32285, 5205, 32351, 4808, 32412, 4410, 32469,
+    4011, 32521, 3612, 32567, 3212, 32609, 2811, 32646,
+    2410, 32678, 2009, 32705, 1608, 32728, 1206, 32745,
+    804, 32757, 402, 32765, 0, 32767, -402, 32765,
+    -804, 32757, -1206, 32745, -1608, 32728, -2009, 32705,
+    -2410, 32678, -2811, 32646, -3212, 32609, -3612, 32567,
+    -4011, 32521, -4410, 32469, -4808, 32412, -5205, 32351,
+    -5602, 32285, -5998, 32213, -6393, 32137, -6786, 32057,
+    -7179, 31971, -7571, 31880, -7962, 31785, -8351, 31685,
+    -8739, 31580, -9126, 31470, -9512, 31356, -9896, 31237,
+    -10278, 31113, -10659, 30985, -11039, 30852, -11417, 30714,
+    -11793, 30571, -12167, 30424, -12539, 30273, -12910, 30117,
+    -13279, 29956, -13645, 29791, -14010, 29621, -14372, 29447,
+    -14732, 29268, -15090, 29085, -15446, 28898, -15800, 28706,
+    -16151, 28510, -16499, 28310, -16846, 28105, -17189, 27896,
+    -17530, 27683, -17869, 27466, -18204, 27245, -18537, 27019,
+    -18868, 26790, -19195, 26556, -19519, 26319, -19841, 26077,
+    -20159, 25832, -20475, 25582, -20787, 25329, -21096, 25072,
+    -21403, 24811, -21705, 24547, -22005, 24279, -22301, 24007,
+    -22594, 23731, -22884, 23452, -23170, 23170, -23452, 22884,
+    -23731, 22594, -24007, 22301, -24279, 22005, -24547, 21705,
+    -24811, 21403, -25072, 21096, -25329, 20787, -25582, 20475,
+    -25832, 20159, -26077, 19841, -26319, 19519, -26556, 19195,
+    -26790, 18868, -27019, 18537, -27245, 18204, -27466, 17869,
+    -27683, 17530, -27896, 17189, -28105, 16846, -28310, 16499,
+    -28510, 16151, -28706, 15800, -28898, 15446, -29085, 15090,
+    -29268, 14732, -29447, 14372, -29621, 14010, -29791, 13645,
+    -29956, 13279, -30117, 12910, -30273, 12539, -30424, 12167,
+    -30571, 11793, -30714, 11417, -30852, 11039, -30985, 10659,
+    -31113, 10278, -31237, 9896, -31356, 9512, -31470, 9126,
+    -31580, 8739, -31685, 8351, -31785, 7962, -31880, 7571,
+    -31971, 7179, -32057, 6786, -32137, 6393, -32213, 5998,
+    -32285, 5602, -32351, 5205, -32412, 4808, -32469, 4410,
+    -32521, 4011, -32567, 3612, -32609, 3212, -32646, 2811,
+    -32678, 2410, -32705, 2009, -32728, 1608, -32745, 1206,
+    -32757, 804, -32765, 402, 32767, 0, 32766, 201,
+    32765, 402, 32761, 603, 32757, 804, 32752, 1005,
+    32745, 1206, 32737, 1407, 32728, 1608, 32717, 1809,
+    32705, 2009, 32692, 2210, 32678, 2410, 32663, 2611,
+    32646, 2811, 32628, 3012, 32609, 3212, 32589, 3412,
+    32567, 3612, 32545, 3811, 32521, 4011, 32495, 4210,
+    32469, 4410, 32441, 4609, 32412, 4808, 32382, 5007,
+    32351, 5205, 32318, 5404, 32285, 5602, 32250, 5800,
+    32213, 5998, 32176, 6195, 32137, 6393, 32098, 6590,
+    32057, 6786, 32014, 6983, 31971, 7179, 31926, 7375,
+    31880, 7571, 31833, 7767, 31785, 7962, 31736, 8157,
+    31685, 8351, 31633, 8545, 31580, 8739, 31526, 8933,
+    31470, 9126, 31414, 9319, 31356, 9512, 31297, 9704,
+    31237, 9896, 31176, 10087, 31113, 10278, 31050, 10469,
+    30985, 10659, 30919, 10849, 30852, 11039, 30783, 11228,
+    30714, 11417, 30643, 11605, 30571, 11793, 30498, 11980,
+    30424, 12167, 30349, 12353, 30273, 12539, 30195, 12725,
+    30117, 12910, 30037, 13094, 29956, 13279, 29874, 13462,
+    29791, 13645, 29706, 13828, 29621, 14010, 29534, 14191,
+    29447, 14372, 29358, 14553, 29268, 14732, 29177, 14912,
+    29085, 15090, 28992, 15269, 28898, 15446, 28803, 15623,
+    28706, 15800, 28609, 15976, 28510, 16151, 28411, 16325,
+    28310, 16499, 28208, 16673, 28105, 16846, 28001, 17018,
+    27896, 17189, 27790, 17360, 27683, 17530, 27575, 17700,
+    27466, 17869, 27356, 18037, 27245, 18204, 27133, 18371,
+    27019, 18537, 26905, 18703, 26790, 18868, 26674, 19032,
+    26556, 19195, 26438, 19357, 26319, 19519, 26198, 19680,
+    26077, 19841, 25955, 20000, 25832, 20159, 25708, 20317,
+    25582, 20475, 25456, 20631, 25329, 20787, 25201, 20942,
+    25072, 21096, 24942, 21250, 24811, 21403, 24680, 21554,
+    24547, 21705, 24413, 21856, 24279, 22005, 24143, 22154,
+    24007, 22301, 23870, 22448, 23731, 22594, 23592, 22739,
+    23452, 22884, 23311, 23027, 23170, 23170, 23027, 23311,
+    22884, 23452, 22739, 23592, 22594, 23731, 22448, 23870,
+    22301, 24007, 22154, 24143, 22005, 24279, 21856, 24413,
+    21705, 24547, 21554, 24680, 21403, 24811, 21250, 24942,
+    21096, 25072, 20942, 25201, 20787, 25329, 20631, 25456,
+    20475, 25582, 20317, 25708, 20159, 25832, 20000, 25955,
+    19841, 26077, 19680, 26198, 19519, 26319, 19357, 26438,
+    19195, 26556, 19032, 26674, 18868, 26790, 18703, 26905,
+    18537, 27019, 18371, 27133, 18204, 27245, 18037, 27356,
+    17869, 27466, 17700, 27575, 17530, 27683, 17360, 27790,
+    17189, 27896, 17018, 28001, 16846, 28105, 16673, 28208,
+    16499, 28310, 16325, 28411, 16151, 28510, 15976, 28609,
+    15800, 28706, 15623, 28803, 15446, 28898, 15269, 28992,
+    15090, 29085, 14912, 29177, 14732, 29268, 14553, 29358,
+    14372, 29447, 14191, 29534, 14010, 29621, 13828, 29706,
+    13645, 29791, 13462, 29874, 13279, 29956, 13094, 30037,
+    12910, 30117, 12725, 30195, 12539, 30273, 12353, 30349,
+    12167, 30424, 11980, 30498, 11793, 30571, 11605, 30643,
+    11417, 30714, 11228, 30783, 11039, 30852, 10849, 30919,
+    10659, 30985, 10469, 31050, 10278, 31113, 10087, 31176,
+    9896, 31237, 9704, 31297, 9512, 31356, 9319, 31414,
+    9126, 31470, 8933, 31526, 8739, 31580, 8545, 31633,
+    8351, 31685, 8157, 31736, 7962, 31785, 7767, 31833,
+    7571, 31880, 7375, 31926, 7179, 31971, 6983, 32014,
+    6786, 32057, 6590, 32098, 6393, 32137, 6195, 32176,
+    5998, 32213, 5800, 32250, 5602, 32285, 5404, 32318,
+    5205, 32351, 5007, 32382, 4808, 32412, 4609, 32441,
+    4410, 32469, 4210, 32495, 4011, 32521, 3811, 32545,
+    3612, 32567, 3412, 32589, 3212, 32609, 3012, 32628,
+    2811, 32646, 2611, 32663, 2410, 32678, 2210, 32692,
+    2009, 32705, 1809, 32717, 1608, 32728, 1407, 32737,
+    1206, 32745, 1005, 32752, 804, 32757, 603, 32761,
+    402, 32765, 201, 32766, 0, 32767, -201, 32766,
+    -402, 32765, -603, 32761, -804, 32757, -1005, 32752,
+    -1206, 32745, -1407, 32737, -1608, 32728, -1809, 32717,
+    -2009, 32705, -2210, 32692, -2410, 32678, -2611, 32663,
+    -2811, 32646, -3012, 32628, -3212, 32609, -3412, 32589,
+    -3612, 32567, -3811, 32545, -4011, 32521, -4210, 32495,
+    -4410, 32469, -4609, 32441, -4808, 32412, -5007, 32382,
+    -5205, 32351, -5404, 32318, -5602, 32285, -5800, 32250,
+    -5998, 32213, -6195, 32176, -6393, 32137, -6590, 32098,
+    -6786, 32057, -6983, 32014, -7179, 31971, -7375, 31926,
+    -7571, 31880, -7767, 31833, -7962, 31785, -8157, 31736,
+    -8351, 31685, -8545, 31633, -8739, 31580, -8933, 31526,
+    -9126, 31470, -9319, 31414, -9512, 31356, -9704, 31297,
+    -9896, 31237, -10087, 31176, -10278, 31113, -10469, 31050,
+    -10659, 30985, -10849, 30919, -11039, 30852, -11228, 30783,
+    -11417, 30714, -11605, 30643, -11793, 30571, -11980, 30498,
+    -12167, 30424, -12353, 30349, -12539, 30273, -12725, 30195,
+    -12910, 30117, -13094, 30037, -13279, 29956, -13462, 29874,
+    -13645, 29791, -13828, 29706, -14010, 29621, -14191, 29534,
+    -14372, 29447, -14553, 29358, -14732, 29268, -14912, 29177,
+    -15090, 29085, -15269, 28992, -15446, 28898, -15623, 28803,
+    -15800, 28706, -15976, 28609, -16151, 28510, -16325, 28411,
+    -16499, 28310, -16673, 28208, -16846, 28105, -17018, 28001,
+    -17189, 27896, -17360, 27790, -17530, 27683, -17700, 27575,
+    -17869, 27466, -18037, 27356, -18204, 27245, -18371, 27133,
+    -18537, 27019, -18703, 26905, -18868, 26790, -19032, 26674,
+    -19195, 26556, -19357, 26438, -19519, 26319, -19680, 26198,
+    -19841, 26077, -20000, 25955, -20159, 25832, -20317, 25708,
+    -20475, 25582, -20631, 25456, -20787, 25329, -20942, 25201,
+    -21096, 25072, -21250, 24942, -21403, 24811, -21554, 24680,
+    -21705, 24547, -21856, 24413, -22005, 24279, -22154, 24143,
+    -22301, 24007, -22448, 23870, -22594, 23731, -22739, 23592,
+    -22884, 23452, -23027, 23311, -23170, 23170, -23311, 23027,
+    -23452, 22884, -23592, 22739, -23731, 22594, -23870, 22448,
+    -24007, 22301, -24143, 22154, -24279, 22005, -24413, 21856,
+    -24547, 21705, -24680, 21554, -24811, 21403, -24942, 21250,
+    -25072, 21096, -25201, 20942, -25329, 20787, -25456, 20631,
+    -25582, 20475, -25708, 20317, -25832, 20159, -25955, 20000,
+    -26077, 19841, -26198, 19680, -26319, 19519, -26438, 19357,
+    -26556, 19195, -26674, 19032, -26790, 18868, -26905, 18703,
+    -27019, 18537, -27133, 18371, -27245, 18204, -27356, 18037,
+    -27466, 17869, -27575, 17700, -27683, 17530, -27790, 17360,
+    -27896, 17189, -28001, 17018, -28105, 16846, -28208, 16673,
+    -28310, 16499, -28411, 16325, -28510, 16151, -28609, 15976,
+    -28706, 15800, -28803, 15623, -28898, 15446, -28992, 15269,
+    -29085, 15090, -29177, 14912, -29268, 14732, -29358, 14553,
+    -29447, 14372, -29534, 14191, -29621, 14010, -29706, 13828,
+    -29791, 13645, -29874, 13462, -29956, 13279, -30037, 13094,
+    -30117, 12910, -30195, 12725, -30273, 12539, -30349, 12353,
+    -30424, 12167, -30498, 11980, -30571, 11793, -30643, 11605,
+    -30714, 11417, -30783, 11228, -30852, 11039, -30919, 10849,
+    -30985, 10659, -31050, 10469, -31113, 10278, -31176, 10087,
+    -31237, 9896, -31297, 9704, -31356, 9512, -31414, 9319,
+    -31470, 9126, -31526, 8933, -31580, 8739, -31633, 8545,
+    -31685, 8351, -31736, 8157, -31785, 7962, -31833, 7767,
+    -31880, 7571, -31926, 7375, -31971, 7179, -32014, 6983,
+    -32057, 6786, -32098, 6590, -32137, 6393, -32176, 6195,
+    -32213, 5998, -32250, 5800, -32285, 5602, -32318, 5404,
+    -32351, 5205, -32382, 5007, -32412, 4808, -32441, 4609,
+    -32469, 4410, -32495, 4210, -32521, 4011, -32545, 3811,
+    -32567, 3612, -32589, 3412, -32609, 3212, -32628, 3012,
+    -32646, 2811, -32663, 2611, -32678, 2410, -32692, 2210,
+    -32705, 2009, -32717, 1809, -32728, 1608, -32737, 1407,
+    -32745, 1206, -32752, 1005, -32757, 804, -32761, 603,
+    -32765, 402, -32766, 201,
+};
@@ -0,0 +1,11 @@
+// Generated by Scripts/gen_fft_tables.py, do not edit
+#pragma once
+#include <stdint.h>
+
+#define FFT_TABLES_HAVE_1024 1
+extern const float fft_radix4_real_twiddles_1024[1532];
+extern const int16_t fft_q15_twiddles_1024[1532];
+
+#define FFT_TABLES_HAVE_2048 1
+extern const float fft_radix4_real_twiddles_2048[3064];
+extern const int16_t fft_q15_twiddles_2048[3068];
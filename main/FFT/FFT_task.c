@@ -1,99 +1,212 @@
 #include "FFT_task.h"
 #include "FFT.h"
-#include "freertos/semphr.h"
+#include "FFT_fixed.h"
+#include "FFT_spectrum.h"
+#include "FFT_stft.h"
+#include "FFT_decimator.h"
+#include "FFT_bars.h"
+#include "FFT_agc.h"
+#include "FFT_beat.h"
+#include "FFT_draw.h"
+#include "Display_task.h"
 #include "freertos/timers.h"
 #include "global_defines.h"
 #include "FrameBuffer.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "system_states.h"
 #include "Events.h"
 
 #include <math.h>
-#include <string.h>
+#include <stdatomic.h>
 
 #define FFT_TASK_STACK_SIZE 3072
-#define FFT_N 2048
-#define TOTAL_TIME 0.0464399
-#define MAX_FFT_MAG 2000000.0
-#define FFT_BUCKETS FRAME_BUF_COLS
+// Sizes and hop are in decimated samples, at 44.1 kHz the input is decimated
+// by 2 so FFT_N 1024 gives the same ~21.5 Hz bins as 2048 at the full rate
+#define FFT_N 1024
+#define FFT_RING_SIZE (2 * FFT_N)
+#define FFT_STEREO_N 2048 // 2 * FFT_N, spelled out for FFT_Q15_STATIC_PLAN
+#define FFT_DEFAULT_HOP 256
+#define FFT_WINDOW FFT_WINDOW_HANN
+#define FFT_FIXED_POINT 1
+#define FFT_DEFAULT_SAMPLE_RATE 44100
+#define MAX_FFT_MAG 2000000
+#define FFT_AGC_PERCENTILE 90
+#define FFT_AGC_MIN_LEVEL (1 << 14)
+#define FFT_AGC_MAX_LEVEL (1 << 26)
+#define FFT_AGC_TARGET_ROWS 7
+#define FFT_MEL_MIN_FREQ 40
+#define FFT_MEL_MAX_FREQ 8000
+#define FFT_SCOPE_STEP 4
+#define FFT_SCOPE_SPAN (FFT_BUCKETS * FFT_SCOPE_STEP)
+#define FFT_SCOPE_SAMPLES (2 * FFT_SCOPE_SPAN)
+#define FFT_SCOPE_MIN_RANGE 256
+#define FFT_VU_RANGE 10
+#define FFT_SPECTROGRAM_FRAMES 4
+#define FFT_SPECTROGRAM_ROWS 5
+#define FFT_ACTIVITY_THRESHOLD 16
+#define FFT_FIRST_PACKET_FRAMES 32
 #define PRINT_DELTA false
 #define FFT_TASK_TAG "FFT_Task"
-#define FFT_MIX_LEFT_RIGHT 0
-struct fft_double_buffer
-{
-    float buf0[FFT_N];
-    float buf1[FFT_N];
-    float *fft_read;
-    float *fft_write;
-    uint32_t widx;
-};
-typedef void (*fft_draw_func_t)(float bucket_mags[]);
+typedef bool (*fft_compute_func_t)(uint32_t frame_end, fft_display_type_t display);
+typedef void (*fft_height_func_t)(const uint32_t bucket_mags[], uint16_t heights[]);
+typedef void (*fft_draw_func_t)(const fft_bars_t *bars);
+typedef struct
+{
+    fft_compute_func_t compute; // Runs on the FFT task once per frame
+    fft_height_func_t heights;  // Bucket magnitudes to bar heights, spectrum modes only
+    fft_draw_func_t draw;       // Runs on the display task once per refresh
+} fft_display_funcs_t;
 
 // Function Prototypes
 static void fft_task(void *pvParameters);
 static void process_fft();
-static void init_fft_buffer(struct fft_double_buffer *fft_buf);
-static inline void swap_fft_buffers(struct fft_double_buffer *fft_buf);
+static void process_frame(uint32_t frame_end);
 static void idle_timer_func(TimerHandle_t xTimer);
-static inline void draw_fft_linear(float bucket_mags[]);
-static inline void draw_fft_logarithmic(float bucket_mags[]);
-static inline void draw_fft_logarithmic_mirror(float bucket_mags[]);
+static void update_sample_rate();
+static void update_agc(const uint32_t bucket_mags[]);
+static void update_beat(const uint32_t bucket_mags[]);
+static int get_decimation_factor(uint32_t rate);
+static bool compute_spectrum(uint32_t frame_end, fft_display_type_t display, uint32_t bucket_mags[]);
+static bool compute_bars(uint32_t frame_end, fft_display_type_t display);
+static bool compute_scope(uint32_t frame_end, fft_display_type_t display);
+static bool compute_vu(uint32_t frame_end, fft_display_type_t display);
+static bool compute_spectrogram(uint32_t frame_end, fft_display_type_t display);
+static bool compute_stereo_spectrum(uint32_t frame_end, uint32_t bucket_mags[2][FFT_BUCKETS]);
+static bool compute_stereo(uint32_t frame_end, fft_display_type_t display);
+static void render_frame();
+static void linear_heights(const uint32_t bucket_mags[], uint16_t heights[]);
+static void log_heights(const uint32_t bucket_mags[], uint16_t heights[]);
+static void draw_bars(const fft_bars_t *bars);
+static void draw_bars_mirror(const fft_bars_t *bars);
+static void draw_columns(const fft_bars_t *bars);
+static void draw_vu(const fft_bars_t *bars);
+static void draw_stereo(const fft_bars_t *bars);
+static bool is_stereo_display(fft_display_type_t display);
 
 
 // File Globals
-static SemaphoreHandle_t xDataReadySem;
-#if defined(CONFIG_DEV_BOARD_DISPLAY)
-static const uint16_t ranges[FFT_BUCKETS] = {
-    50, 100, 141, 185, 233, 285, 343, 406, 476, 553,
-    637, 729, 829, 937, 1053, 1179, 1314, 1459,
-    1614, 1778, 1954, 2140, 2336, 2544, 2764, 2995,
-    3238, 3493, 3760, 4040, 4333, 4638, 4957, 5289,
-    5635, 5994, 6367, 6754, 7156, 7572, // 8002,
-};
-#elif defined(CONFIG_FORM_FACTOR_DISPLAY)
-static const uint16_t ranges[FFT_BUCKETS] = {
-    73, 111, 157, 212, 276, 350, 434, 529,
-    635, 753, 884, 1027, 1185, 1356, 1542, 1744, 
-    1961, 2194, 2444, 2712, 2998, 3302, 3625, 3968, 
-    4331, 4715, 5120, 5546, 5995, 6467, 6963, 7482
-};
-#else
-#error "Invalid display type"
-#endif
-
 static const char *FFT_DISPLAY_NAMES[NUM_FFT_DISPLAYS] = {
     "FFT_LINEAR",
     "FFT_LOG",
     "FFT_LOG_MIRROR",
+    "FFT_MEL",
+    "FFT_SCOPE",
+    "FFT_VU",
+    "FFT_SPECTROGRAM",
+    "FFT_STEREO",
+    "FFT_STEREO_SPLIT",
 };
 
+// Static plans, twiddles are const tables in flash (FFT_tables.c)
+#if FFT_FIXED_POINT
+// Both plans run in place on fft_buf, the stereo one transforms FFT_N
+// left/right pairs as one FFT_N point complex FFT
+#if FFT_STEREO_N != 2 * FFT_N
+#error "FFT_STEREO_N must be 2 * FFT_N"
+#endif
+static int16_t fft_buf[FFT_STEREO_N];
+static fft_q15_config_t real_fft_plan = FFT_Q15_STATIC_PLAN(FFT_N, fft_buf);
+static fft_q15_config_t stereo_fft_plan = FFT_Q15_STATIC_PLAN(FFT_STEREO_N, fft_buf);
+#else
 static float fft_output[FFT_N];
 static float fft_input[FFT_N];
-static struct fft_double_buffer fft_buf;
-static fft_config_t *real_fft_plan;
+static fft_config_t real_fft_plan = FFT_RADIX4_REAL_STATIC_PLAN(FFT_N, FFT_FORWARD, fft_input, fft_output);
+#endif
+static int16_t fft_ring[FFT_RING_SIZE];
+static int16_t fft_ring_right[FFT_RING_SIZE];
+static int16_t fft_window[FFT_N / 2];
+static fft_stft_t stft;
+static fft_decimator_t decimator;
+static fft_decimator_t decimator_right;
+static bool stereo_input = false; // Producer side, the rings hold left/right instead of mono
+static volatile int requested_decimation;
+static fft_bucket_plan_t bucket_plan;
+static fft_filterbank_t mel_filterbank;
+static uint32_t sample_rate = FFT_DEFAULT_SAMPLE_RATE;
+static volatile uint32_t requested_sample_rate = FFT_DEFAULT_SAMPLE_RATE;
 static TaskHandle_t xfft_task = NULL;
 TimerHandle_t idle_timer;
 static fft_display_type_t fft_display = FFT_LOG;
 static uint32_t log_base_value = 20000;
-static fft_draw_func_t fft_display_funcs[NUM_FFT_DISPLAYS] = {
-    draw_fft_linear,
-    draw_fft_logarithmic,
-    draw_fft_logarithmic_mirror,
+static fft_agc_t agc;
+static uint32_t agc_hop = 0;
+static volatile bool agc_enabled = true;
+static fft_beat_t beat;
+static uint32_t beat_hop = 0;
+static volatile uint32_t beat_bpm = 0;
+static const fft_display_funcs_t fft_display_funcs[NUM_FFT_DISPLAYS] = {
+    {compute_bars, linear_heights, draw_bars},
+    {compute_bars, log_heights, draw_bars},
+    {compute_bars, log_heights, draw_bars_mirror},
+    {compute_bars, log_heights, draw_bars},
+    {compute_scope, NULL, draw_columns},
+    {compute_vu, NULL, draw_vu},
+    {compute_spectrogram, log_heights, draw_columns},
+    {compute_stereo, log_heights, draw_stereo},
+    {compute_stereo, log_heights, draw_bars},
 };
+static fft_bars_t bars;
+static uint8_t display_columns[FFT_BUCKETS]; // Bit y lights row y, for modes drawn by draw_columns()
+static int16_t scope_samples[FFT_SCOPE_SAMPLES];
+static uint8_t spectrogram_column = 0;
+static int spectrogram_frames = 0;
+
+// Working storage of the stereo modes, kept off the FFT task stack like the
+// plans. Only the FFT task touches them.
+static uint32_t stereo_mags[2][FFT_BUCKETS];
+static uint16_t stereo_heights[2][FFT_BUCKETS];
+static uint32_t stereo_loudest[FFT_BUCKETS];
+static uint16_t stereo_split[FFT_BUCKETS];
+#if !FFT_FIXED_POINT
+static float stereo_float_mags[FFT_BUCKETS];
+#endif
+
+// Stereo levels for the VU mode, accumulated by read_data_stream() between
+// frames and published when a frame is queued. Entries are read one at a
+// time, a torn update between channels only shows for one frame.
+static uint64_t vu_acc_sum_sq[2];
+static uint32_t vu_acc_count;
+static uint16_t vu_acc_peak[2];
+static volatile uint32_t vu_mean_sq[2];
+static volatile uint16_t vu_peak[2];
+
+// Mean absolute level of the mono mix over the last frame, from read_data_stream()
+static uint32_t activity_acc = 0;
+static uint32_t activity_count = 0;
+static volatile uint32_t activity_level = 0;
+static bool audio_active = false;
+static uint32_t first_packet_frames = 0;
+static atomic_int fft_subscribers = 0;
 
 extern state_manager_t state_manager;
 
 // Public Functions
 int init_fft_task()
 {
-    real_fft_plan = fft_init(FFT_N, FFT_REAL, FFT_FORWARD, fft_input, fft_output);
-    init_fft_buffer(&fft_buf);
-    xDataReadySem = xSemaphoreCreateBinary();
-    if (xDataReadySem == NULL)
+    requested_decimation = get_decimation_factor(sample_rate);
+    fft_decimator_init(&decimator, requested_decimation);
+    fft_decimator_init(&decimator_right, requested_decimation);
+    if (fft_bucket_plan_init(&bucket_plan, fft_bucket_ranges, FFT_BUCKETS, FFT_N, (float)sample_rate / decimator.factor) < 0)
+    {
+        ESP_LOGE(FFT_TASK_TAG, "Could not create FFT bucket plan");
+        return -1;
+    }
+    if (fft_filterbank_init(&mel_filterbank, FFT_BUCKETS, FFT_MEL_MIN_FREQ, FFT_MEL_MAX_FREQ, FFT_N, (float)sample_rate / decimator.factor) < 0)
     {
-        ESP_LOGE(FFT_TASK_TAG, "Could not allocate data ready semaphore");
+        ESP_LOGE(FFT_TASK_TAG, "Could not create mel filterbank");
         return -1;
     }
+    if (fft_stft_init(&stft, fft_ring, FFT_RING_SIZE, fft_window, FFT_N, FFT_DEFAULT_HOP) < 0)
+    {
+        ESP_LOGE(FFT_TASK_TAG, "Could not initialize STFT");
+        return -1;
+    }
+    fft_stft_set_window(&stft, FFT_WINDOW);
+    fft_stft_set_right_ring(&stft, fft_ring_right);
+    fft_bars_init(&bars, DISPLAY_REFRESH_RATE_HZ);
+    fft_agc_init(&agc, FFT_AGC_PERCENTILE, FFT_AGC_MIN_LEVEL, FFT_AGC_MAX_LEVEL);
+    fft_beat_init(&beat, FFT_AGC_MIN_LEVEL);
     idle_timer = xTimerCreate("Idle_Timer", MS_TO_TICKS(10000), pdFALSE, NULL, idle_timer_func);
     xTaskCreate(
         fft_task,
@@ -111,29 +224,98 @@ void read_data_stream(const uint8_t *data, uint32_t length)
     {
         return;
     }
+    // Runs in the Bluetooth data callback: no logging and no kernel calls
+    // besides the task notification
     // Odd samples are left channel, even samples are right channel
     int16_t *samples = (int16_t *)data;
     uint32_t sample_count = length / 2;
+    bool frame_ready = false;
+    bool vu = (fft_display == FFT_VU);
+    bool stereo = is_stereo_display(fft_display);
+
+    // Factor changes are requested by the FFT task, the decimator state
+    // belongs to this context. Both channels restart together so they
+    // produce their outputs on the same input samples.
+    if (decimator.factor != requested_decimation || stereo != stereo_input)
+    {
+        fft_decimator_set_factor(&decimator, requested_decimation);
+        fft_decimator_set_factor(&decimator_right, requested_decimation);
+        stereo_input = stereo;
+    }
 
-    for (int i = 0; i < sample_count; i += 2)
+    fft_stft_begin_write(&stft, (sample_count / 2 + decimator.factor - 1) / decimator.factor);
+    if (stereo)
     {
-#if FFT_MIX_LEFT_RIGHT
-        int16_t data = (samples[i] >> 1) + (samples[i+1] >> 1);
-        fft_buf.fft_write[fft_buf.widx++] = (float)data;
-#else
-        fft_buf.fft_write[fft_buf.widx++] = (float)samples[i];
-#endif
-        if (fft_buf.widx >= FFT_N)
+        for (int i = 0; i < sample_count; i += 2)
+        {
+            int16_t mono = (int16_t)(((int32_t)samples[i] + samples[i + 1]) >> 1);
+            activity_acc += (mono < 0) ? -mono : mono;
+            int16_t left;
+            int16_t right = 0;
+            fft_decimator_push(&decimator_right, samples[i + 1], &right);
+            if (fft_decimator_push(&decimator, samples[i], &left))
+            {
+                frame_ready |= fft_stft_push_stereo(&stft, left, right);
+            }
+        }
+    }
+    else
+    {
+        for (int i = 0; i < sample_count; i += 2)
         {
-            swap_fft_buffers(&fft_buf);
-            fft_buf.widx = 0;
-            if (xSemaphoreGive(xDataReadySem) != pdTRUE)
+            // Downmix to mono at full precision before decimating
+            int16_t mono = (int16_t)(((int32_t)samples[i] + samples[i + 1]) >> 1);
+            activity_acc += (mono < 0) ? -mono : mono;
+            int16_t out;
+            if (fft_decimator_push(&decimator, mono, &out))
             {
-                // Failed to give semaphore
-                ESP_LOGE(FFT_TASK_TAG, "Failed to give semaphore");
+                frame_ready |= fft_stft_push(&stft, out);
             }
         }
     }
+
+    activity_count += sample_count / 2;
+    if (frame_ready && activity_count > 0)
+    {
+        activity_level = activity_acc / activity_count;
+        activity_acc = 0;
+        activity_count = 0;
+    }
+
+    if (vu)
+    {
+        for (int c = 0; c < 2; c++)
+        {
+            uint64_t sum_sq = vu_acc_sum_sq[c];
+            uint16_t peak = vu_acc_peak[c];
+            for (int i = c; i < sample_count; i += 2)
+            {
+                int32_t s = samples[i];
+                uint16_t mag = (uint16_t)((s < 0) ? -s : s);
+                sum_sq += (uint32_t)(s * s);
+                peak = (mag > peak) ? mag : peak;
+            }
+            vu_acc_sum_sq[c] = sum_sq;
+            vu_acc_peak[c] = peak;
+        }
+        vu_acc_count += sample_count / 2;
+        if (frame_ready && vu_acc_count > 0)
+        {
+            for (int c = 0; c < 2; c++)
+            {
+                vu_mean_sq[c] = (uint32_t)(vu_acc_sum_sq[c] / vu_acc_count);
+                vu_peak[c] = vu_acc_peak[c];
+                vu_acc_sum_sq[c] = 0;
+                vu_acc_peak[c] = 0;
+            }
+            vu_acc_count = 0;
+        }
+    }
+
+    if (frame_ready && xfft_task != NULL)
+    {
+        xTaskNotifyGive(xfft_task);
+    }
 }
 
 TaskHandle_t fft_task_handle()
@@ -141,6 +323,73 @@ TaskHandle_t fft_task_handle()
     return xfft_task;
 }
 
+uint32_t get_fft_sample_rate()
+{
+    return sample_rate;
+}
+
+void set_fft_sample_rate(uint32_t rate)
+{
+    // Picked up by the FFT task before its next frame
+    requested_sample_rate = rate;
+}
+
+uint32_t get_fft_hop_size()
+{
+    return stft.hop;
+}
+
+int set_fft_hop_size(uint32_t hop)
+{
+    return fft_stft_set_hop(&stft, hop);
+}
+
+/**
+ * @brief Registers a consumer of the FFT output. Frames are only computed,
+ * and the visualizer only drawn, while at least one consumer is subscribed.
+ * Activity detection always runs.
+ */
+void fft_subscribe()
+{
+    if (atomic_fetch_add(&fft_subscribers, 1) == 0)
+    {
+        set_display_frame_callback(render_frame);
+    }
+}
+
+void fft_unsubscribe()
+{
+    if (atomic_fetch_sub(&fft_subscribers, 1) == 1)
+    {
+        // Lets the display stop scanning once the frame is blank
+        set_display_frame_callback(NULL);
+    }
+}
+
+/**
+ * @brief Whether the last frame of audio was above the activity threshold
+ */
+bool get_fft_audio_active()
+{
+    return audio_active;
+}
+
+/**
+ * @brief Tempo of the music in beats per minute, 0 while unknown. Beats are
+ * tracked while a spectrum mode is computed, each one is published as
+ * BEAT_DETECTED while a callback is registered for it.
+ */
+uint32_t get_fft_beat_bpm()
+{
+    return beat_bpm;
+}
+
+void get_fft_frame_stats(uint32_t *dropped, uint32_t *late)
+{
+    *dropped = stft.dropped_frames;
+    *late = stft.late_frames;
+}
+
 fft_display_type_t get_fft_display_type()
 {
     return fft_display;
@@ -161,179 +410,533 @@ void set_fft_log_min(uint32_t log_min)
     log_base_value = log_min;
 }
 
+bool get_fft_agc_enabled()
+{
+    return agc_enabled;
+}
+
+/**
+ * @brief Enables automatic scaling of the bars. When disabled, linear bars
+ * are scaled to MAX_FFT_MAG and logarithmic bars start at the log min
+ * (set_fft_log_min())
+ */
+void set_fft_agc_enabled(bool enabled)
+{
+    agc_enabled = enabled;
+}
+
 const char *get_fft_display_type_name(fft_display_type_t fft)
 {
     return FFT_DISPLAY_NAMES[fft];
 }
 
+/**
+ * @brief Sets how fast the bars rise and fall toward each new FFT frame
+ * @param attack_ms Rise time constant, 0 to jump to new peaks
+ * @param release_ms Fall time constant, 0 to drop immediately
+ */
+void set_fft_smoothing(uint32_t attack_ms, uint32_t release_ms)
+{
+    fft_bars_set_smoothing(&bars, attack_ms, release_ms);
+}
+
+/**
+ * @brief Sets how long the peak dots hold and how fast they fall after
+ * @param hold_ms Hold time, 0 to start falling right away
+ * @param fall_rows_per_s Fall speed in display rows per second
+ */
+void set_fft_peak_hold(uint32_t hold_ms, uint32_t fall_rows_per_s)
+{
+    fft_bars_set_peak_hold(&bars, hold_ms, fall_rows_per_s);
+}
+
 // Private Functions
-static void init_fft_buffer(struct fft_double_buffer *fft_buf)
+static void render_frame()
 {
-    fft_buf->widx = 0;
-    fft_buf->fft_read = fft_buf->buf0;
-    fft_buf->fft_write = fft_buf->buf1;
-    fft_buf->widx = 0;
-    for (int i = 0; i < FFT_N; i++)
+    // Display task context, once per refresh
+    if (get_system_state(&state_manager) != STREAMING_STATE_)
+    {
+        return;
+    }
+    // Steps follow the refresh, which drops when idle and depends on the depth
+    uint32_t refresh_hz = (uint32_t)get_display_refresh_rate();
+    if (refresh_hz != bars.rate_hz)
     {
-        fft_buf->buf0[0] = 0;
-        fft_buf->buf0[1] = 0;
+        fft_bars_set_rate(&bars, refresh_hz);
     }
+    fft_bars_step(&bars);
+    fft_display_funcs[fft_display].draw(&bars);
 }
 
-static inline void swap_fft_buffers(struct fft_double_buffer *fft_buf)
+static void linear_heights(const uint32_t bucket_mags[], uint16_t heights[])
 {
-    float *temp = fft_buf->fft_read;
-    fft_buf->fft_read = fft_buf->fft_write;
-    fft_buf->fft_write = temp;
+    // With the AGC, the tracked percentile reaches FFT_AGC_TARGET_ROWS
+    uint64_t full_scale = MAX_FFT_MAG;
+    if (agc_enabled)
+    {
+        full_scale = (uint64_t)fft_agc_reference(&agc) * FRAME_BUF_ROWS / FFT_AGC_TARGET_ROWS;
+    }
+    for (int i = 0; i < FFT_BUCKETS; i++)
+    {
+        uint64_t height = ((uint64_t)bucket_mags[i] * FFT_BARS_MAX_HEIGHT) / full_scale;
+        heights[i] = (height > FFT_BARS_MAX_HEIGHT) ? FFT_BARS_MAX_HEIGHT : (uint16_t)height;
+    }
 }
 
-
-static inline void draw_fft_linear(float bucket_mags[])
+static void log_heights(const uint32_t bucket_mags[], uint16_t heights[])
 {
-    buffer_clear(&display_buffer);
+    // One row per doubling above log_min, with the AGC log_min is
+    // FFT_AGC_TARGET_ROWS doublings below the tracked percentile
+    uint32_t log_min = (log_base_value > 0) ? log_base_value : 1;
+    if (agc_enabled)
+    {
+        log_min = fft_agc_reference(&agc) >> FFT_AGC_TARGET_ROWS;
+    }
+    uint32_t floor_q8 = fft_log2_q8(log_min);
     for (int i = 0; i < FFT_BUCKETS; i++)
     {
-        if (bucket_mags[i] > MAX_FFT_MAG)
-        {
-            bucket_mags[i] = MAX_FFT_MAG;
-        }
-        int height = (int)((bucket_mags[i] / MAX_FFT_MAG) * 8);
-        for (int j = 0; j < height; j++)
+        uint32_t mag = bucket_mags[i];
+        uint32_t height = 0;
+        if (mag > log_min)
         {
-            //buffer_set_pixel(&display_buffer, i, j);
-            buffer_set_pixel(&display_buffer, i, (FRAME_BUF_ROWS - 1) - j);
+            height = fft_log2_q8(mag) - floor_q8;
         }
+        heights[i] = (height > FFT_BARS_MAX_HEIGHT) ? FFT_BARS_MAX_HEIGHT : (uint16_t)height;
     }
-    buffer_update(&display_buffer);
 }
-static inline void draw_fft_logarithmic(float bucket_mags[])
+
+static void draw_bars(const fft_bars_t *bars)
 {
-    uint32_t log_min = log_base_value;
-    buffer_clear(&display_buffer);
-    for (int i = 0; i < FFT_BUCKETS; i++)
+    fft_draw_bars(&display_buffer, bars);
+}
+
+static void draw_bars_mirror(const fft_bars_t *bars)
+{
+    fft_draw_bars_mirror(&display_buffer, bars);
+}
+
+static void draw_columns(const fft_bars_t *bars)
+{
+    fft_draw_columns(&display_buffer, display_columns);
+}
+
+static void draw_vu(const fft_bars_t *bars)
+{
+    fft_draw_vu(&display_buffer, bars);
+}
+
+static void draw_stereo(const fft_bars_t *bars)
+{
+    fft_draw_stereo(&display_buffer, bars);
+}
+
+static bool is_stereo_display(fft_display_type_t display)
+{
+    return display == FFT_STEREO || display == FFT_STEREO_SPLIT;
+}
+
+static void fft_task(void *pvParameters)
+{
+    while (1)
+    {
+        process_fft();
+    }
+}
+
+void process_fft()
+{
+    // One notification may cover several queued frames
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    update_sample_rate();
+
+    uint32_t frame_end;
+    while (fft_stft_next_frame(&stft, &frame_end))
+    {
+        process_frame(frame_end);
+    }
+}
+
+static void process_frame(uint32_t frame_end)
+{
+    int64_t fft_start_time = esp_timer_get_time();
+    int64_t fft_end_time;
+
+    // Silence neither starts streaming nor keeps it alive
+    audio_active = (activity_level >= FFT_ACTIVITY_THRESHOLD);
+    if (audio_active)
     {
-        uint32_t mag = (uint32_t)bucket_mags[i];
-        uint8_t height = 0;
-        while (mag > log_min)
+        system_states_t state = get_system_state(&state_manager);
+        if (state != STREAMING_STATE_)
         {
-            mag = mag >> 1;
-            height++;
-            if (height >= 8)
+            // Repeated while not streaming in case the current state ignores it
+            if (first_packet_frames == 0)
             {
-                break;
+                push_event(FIRST_AUDIO_PACKET, false);
             }
+            first_packet_frames = (first_packet_frames + 1) % FFT_FIRST_PACKET_FRAMES;
+        }
+        else
+        {
+            first_packet_frames = 0;
         }
 
-        for (uint8_t j = 0; j < height; j++)
+        if (xTimerStart(idle_timer, 0) != pdPASS)
         {
-            buffer_set_pixel(&display_buffer, i, (FRAME_BUF_ROWS - 1) - j);
+            ESP_LOGE(FFT_TASK_TAG, "Failed to start idle timer");
         }
     }
-    buffer_update(&display_buffer);
+
+    // Nothing to draw into without a consumer, e.g. while the display is off
+    if (atomic_load(&fft_subscribers) <= 0)
+    {
+        return;
+    }
+
+    // Each mode computes only what it draws, the oscilloscope and VU modes skip the FFT
+    fft_display_type_t display = fft_display;
+    if (!fft_display_funcs[display].compute(frame_end, display))
+    {
+        return;
+    }
+    fft_end_time = esp_timer_get_time();
+
+    if (PRINT_DELTA)
+    {
+        int32_t delta_fft = (int32_t)(fft_end_time - fft_start_time);
+        int32_t delta_total = (int32_t)(esp_timer_get_time() - fft_start_time);
+        ESP_LOGI(FFT_TASK_TAG, "Delta FFT: %dus, Delta Total: %dus, Dropped: %u, Late: %u",
+                 delta_fft, delta_total, stft.dropped_frames, stft.late_frames);
+    }
 }
-static inline void draw_fft_logarithmic_mirror(float bucket_mags[])
+
+static bool compute_spectrum(uint32_t frame_end, fft_display_type_t display, uint32_t bucket_mags[])
 {
-    uint32_t log_min = log_base_value;
-    buffer_clear(&display_buffer);
+#if FFT_FIXED_POINT
+    // The windowed read is the only copy, the FFT then runs in place
+    fft_stft_read_frame_q15(&stft, frame_end, fft_buf);
+    if (!fft_stft_frame_intact(&stft, frame_end))
+    {
+        return false;
+    }
+    int exponent = fft_q15_execute(&real_fft_plan);
+    if (display == FFT_MEL)
+    {
+        fft_filterbank_apply_q(&mel_filterbank, fft_buf, exponent, stft.window_gain_q8, bucket_mags);
+    }
+    else
+    {
+        fft_bucket_plan_apply_q(&bucket_plan, fft_buf, exponent, stft.window_gain_q8, bucket_mags);
+    }
+#else
+    float float_mags[FFT_BUCKETS];
+    fft_stft_read_frame(&stft, frame_end, fft_input);
+    if (!fft_stft_frame_intact(&stft, frame_end))
+    {
+        return false;
+    }
+    fft_execute(&real_fft_plan);
+    if (display == FFT_MEL)
+    {
+        fft_filterbank_apply(&mel_filterbank, real_fft_plan.output, float_mags);
+    }
+    else
+    {
+        fft_bucket_plan_apply(&bucket_plan, real_fft_plan.output, float_mags);
+    }
     for (int i = 0; i < FFT_BUCKETS; i++)
     {
-        uint32_t mag = (uint32_t)bucket_mags[i];
-        uint8_t height = 0;
-        while (mag > log_min)
+        bucket_mags[i] = (uint32_t)float_mags[i];
+    }
+#endif
+    update_agc(bucket_mags);
+    update_beat(bucket_mags);
+    return true;
+}
+
+static bool compute_bars(uint32_t frame_end, fft_display_type_t display)
+{
+    uint32_t bucket_mags[FFT_BUCKETS];
+    uint16_t heights[FFT_BUCKETS];
+    if (!compute_spectrum(frame_end, display, bucket_mags))
+    {
+        return false;
+    }
+
+    // Drawn by render_frame() on the next display refresh
+    fft_display_funcs[display].heights(bucket_mags, heights);
+    fft_bars_set_target(&bars, heights, FFT_BUCKETS);
+    return true;
+}
+
+static bool compute_scope(uint32_t frame_end, fft_display_type_t display)
+{
+    fft_stft_read_samples(&stft, frame_end, scope_samples, FFT_SCOPE_SAMPLES);
+    if (!fft_stft_frame_intact(&stft, frame_end))
+    {
+        return false;
+    }
+
+    // Trigger on the first rising zero crossing of the older half so the
+    // trace holds still for periodic input, or show the newest samples
+    int start = FFT_SCOPE_SAMPLES - FFT_SCOPE_SPAN;
+    for (int i = 1; i <= FFT_SCOPE_SAMPLES - FFT_SCOPE_SPAN; i++)
+    {
+        if (scope_samples[i - 1] < 0 && scope_samples[i] >= 0)
         {
-            mag = mag >> 1;
-            height++;
-            if (height >= 8)
-            {
-                break;
-            }
+            start = i;
+            break;
         }
+    }
 
-        for (uint8_t j = 0; j < height/2; j++)
+    // Average FFT_SCOPE_STEP samples per column and range to the peak
+    int32_t points[FFT_BUCKETS];
+    int32_t range = FFT_SCOPE_MIN_RANGE;
+    for (int x = 0; x < FFT_BUCKETS; x++)
+    {
+        const int16_t *s = &scope_samples[start + x * FFT_SCOPE_STEP];
+        int32_t sum = 0;
+        for (int k = 0; k < FFT_SCOPE_STEP; k++)
         {
-            buffer_set_pixel(&display_buffer, i, j+4);
-            buffer_set_pixel(&display_buffer, i,  3 - j);
+            sum += s[k];
         }
+        points[x] = sum / FFT_SCOPE_STEP;
+        int32_t mag = (points[x] < 0) ? -points[x] : points[x];
+        range = (mag > range) ? mag : range;
     }
-    buffer_update(&display_buffer);
+
+    // Positive up, each column joins its point to the previous one
+    int prev_row = -1;
+    for (int x = 0; x < FFT_BUCKETS; x++)
+    {
+        int row = (int)((FRAME_BUF_ROWS / 2) * (range - points[x]) / (range + 1));
+        int lo = (prev_row >= 0 && prev_row < row) ? prev_row : row;
+        int hi = (prev_row > row) ? prev_row : row;
+        display_columns[x] = (uint8_t)((0xFF << lo) & (0xFF >> (7 - hi)));
+        prev_row = row;
+    }
+    return true;
 }
 
-static void fft_task(void *pvParameters)
+static bool compute_vu(uint32_t frame_end, fft_display_type_t display)
 {
-    while (1)
+    // Levels are computed by read_data_stream(), FFT_VU_RANGE doublings
+    // below full scale map to an empty bar
+    uint16_t heights[FFT_BUCKETS] = {0};
+    const int32_t floor_q8 = (15 - FFT_VU_RANGE) << 8;
+    for (int c = 0; c < 2; c++)
     {
-        process_fft();
+        uint32_t mean_sq = vu_mean_sq[c];
+        uint16_t peak = vu_peak[c];
+        // log2 of the RMS is half the log2 of the mean square
+        int32_t rms_q8 = (mean_sq > 0) ? (int32_t)fft_log2_q8(mean_sq) / 2 : 0;
+        int32_t peak_q8 = (peak > 0) ? (int32_t)fft_log2_q8(peak) : 0;
+        rms_q8 = (rms_q8 > floor_q8) ? rms_q8 - floor_q8 : 0;
+        peak_q8 = (peak_q8 > floor_q8) ? peak_q8 - floor_q8 : 0;
+        heights[c] = (uint16_t)(rms_q8 * FFT_BARS_MAX_HEIGHT / (FFT_VU_RANGE << 8));
+        heights[2 + c] = (uint16_t)(peak_q8 * FFT_BARS_MAX_HEIGHT / (FFT_VU_RANGE << 8));
     }
+    fft_bars_set_target(&bars, heights, FFT_BUCKETS);
+    return true;
 }
 
-void process_fft()
+static bool compute_spectrogram(uint32_t frame_end, fft_display_type_t display)
 {
-    if (xSemaphoreTake(xDataReadySem, portMAX_DELAY) == pdFALSE)
+    uint32_t bucket_mags[FFT_BUCKETS];
+    uint16_t heights[FFT_BUCKETS];
+    if (!compute_spectrum(frame_end, display, bucket_mags))
     {
-        ESP_LOGE(FFT_TASK_TAG, "Failed to take semaphore");
-        return;
+        return false;
     }
+    fft_display_funcs[display].heights(bucket_mags, heights);
 
-    int32_t fft_start_time = esp_log_timestamp();
-    int32_t fft_end_time;
-    memcpy((void *)fft_input, (void *)fft_buf.fft_read, sizeof(fft_input));
+    // One row per band of buckets, lowest band at the bottom, lit when the
+    // band gets within a few doublings of the AGC level
+    for (int r = 0; r < FRAME_BUF_ROWS; r++)
+    {
+        uint16_t height = 0;
+        for (int i = r * FFT_BUCKETS / FRAME_BUF_ROWS; i < (r + 1) * FFT_BUCKETS / FRAME_BUF_ROWS; i++)
+        {
+            height = (heights[i] > height) ? heights[i] : height;
+        }
+        spectrogram_column |= (height >= FFT_SPECTROGRAM_ROWS * FFT_BARS_ONE_ROW) << (FRAME_BUF_ROWS - 1 - r);
+    }
 
-    float bucket_mags[FFT_BUCKETS] = {0.0};
-    float freq;
-    float mag;
-    fft_execute(real_fft_plan);
-    for (int k = 1; k < real_fft_plan->size / 2; k++)
+    // Scroll left by one column every FFT_SPECTROGRAM_FRAMES frames
+    if (++spectrogram_frames >= FFT_SPECTROGRAM_FRAMES)
     {
-        /*The real part of a magnitude at a frequency is
-          followed by the corresponding imaginary part in the output*/
-        freq = k * 1.0 / TOTAL_TIME;
-        if (freq > ranges[FFT_BUCKETS - 1])
+        for (int x = 0; x < FFT_BUCKETS - 1; x++)
         {
-            // Exit loop if current freq exceeds values in FFT bucket range
-            break;
+            display_columns[x] = display_columns[x + 1];
         }
-        mag = sqrt(pow(real_fft_plan->output[2 * k], 2) + pow(real_fft_plan->output[2 * k + 1], 2));
+        display_columns[FFT_BUCKETS - 1] = spectrogram_column;
+        spectrogram_column = 0;
+        spectrogram_frames = 0;
+    }
+    return true;
+}
 
-        int bidx;
-        for (bidx = 0; bidx < FFT_BUCKETS; bidx++)
+static bool compute_stereo_spectrum(uint32_t frame_end, uint32_t bucket_mags[2][FFT_BUCKETS])
+{
+#if FFT_FIXED_POINT
+    // One complex FFT for both channels, each half of fft_buf then holds a
+    // packed FFT_N point spectrum
+    fft_stft_read_frame_stereo_q15(&stft, frame_end, fft_buf);
+    if (!fft_stft_frame_intact(&stft, frame_end))
+    {
+        return false;
+    }
+    int exponent = fft_q15_execute_stereo(&stereo_fft_plan);
+    for (int c = 0; c < 2; c++)
+    {
+        fft_bucket_plan_apply_q(&bucket_plan, fft_buf + c * FFT_N, exponent, stft.window_gain_q8, bucket_mags[c]);
+    }
+#else
+    // No complex static plan for the float path, one real FFT per channel
+    for (int c = 0; c < 2; c++)
+    {
+        if (c == 0)
         {
-            if (freq < ranges[bidx])
-            {
-                break;
-            }
+            fft_stft_read_frame(&stft, frame_end, fft_input);
         }
-        if (bidx >= FFT_BUCKETS)
+        else
         {
-            bidx = FFT_BUCKETS - 1;
+            fft_stft_read_frame_right(&stft, frame_end, fft_input);
         }
-
-        if (mag > bucket_mags[bidx])
+        fft_execute(&real_fft_plan);
+        fft_bucket_plan_apply(&bucket_plan, real_fft_plan.output, stereo_float_mags);
+        for (int i = 0; i < FFT_BUCKETS; i++)
         {
-            bucket_mags[bidx] = mag;
+            bucket_mags[c][i] = (uint32_t)stereo_float_mags[i];
         }
     }
+    if (!fft_stft_frame_intact(&stft, frame_end))
+    {
+        return false;
+    }
+#endif
 
-    // End of FFT Calculations
-    fft_end_time = esp_log_timestamp();
-    system_states_t state = get_system_state(&state_manager);
-    if (state != STREAMING_STATE_) {
-        push_event(FIRST_AUDIO_PACKET, false);
+    // One AGC for both channels so their bars stay comparable
+    for (int i = 0; i < FFT_BUCKETS; i++)
+    {
+        stereo_loudest[i] = (bucket_mags[0][i] > bucket_mags[1][i]) ? bucket_mags[0][i] : bucket_mags[1][i];
+    }
+    update_agc(stereo_loudest);
+    update_beat(stereo_loudest);
+    return true;
+}
+
+static bool compute_stereo(uint32_t frame_end, fft_display_type_t display)
+{
+    if (!compute_stereo_spectrum(frame_end, stereo_mags))
+    {
+        return false;
     }
-    else {
-        fft_display_funcs[fft_display](bucket_mags);
+    for (int c = 0; c < 2; c++)
+    {
+        fft_display_funcs[display].heights(stereo_mags[c], stereo_heights[c]);
     }
 
-    if (xTimerStart(idle_timer, 0) != pdPASS)
+    if (display == FFT_STEREO)
     {
-        ESP_LOGE(FFT_TASK_TAG, "Failed to start idle timer");
+        // Left bars then right bars, drawn by draw_stereo()
+        fft_bars_set_target(&bars, &stereo_heights[0][0], 2 * FFT_BUCKETS);
+        return true;
     }
 
-    if (PRINT_DELTA)
+    // Split by columns, left channel on the left half. Pairs of buckets
+    // share a column, lowest frequencies meet in the middle.
+    const int half = FFT_BUCKETS / 2;
+    for (int j = 0; j < half; j++)
+    {
+        uint16_t left = (stereo_heights[0][2 * j] > stereo_heights[0][2 * j + 1]) ? stereo_heights[0][2 * j] : stereo_heights[0][2 * j + 1];
+        uint16_t right = (stereo_heights[1][2 * j] > stereo_heights[1][2 * j + 1]) ? stereo_heights[1][2 * j] : stereo_heights[1][2 * j + 1];
+        stereo_split[half - 1 - j] = left;
+        stereo_split[half + j] = right;
+    }
+    fft_bars_set_target(&bars, stereo_split, FFT_BUCKETS);
+    return true;
+}
+
+static void update_sample_rate()
+{
+    uint32_t rate = requested_sample_rate;
+    if (rate == sample_rate)
+    {
+        return;
+    }
+
+    // Rebuild the bin to bucket mapping in place, buffers and plans are sized by FFT_N
+    int factor = get_decimation_factor(rate);
+    uint32_t old_rate = sample_rate / requested_decimation;
+    uint32_t new_rate = rate / factor;
+    if (fft_bucket_plan_init(&bucket_plan, fft_bucket_ranges, FFT_BUCKETS, FFT_N, (float)rate / factor) < 0 ||
+        fft_filterbank_init(&mel_filterbank, FFT_BUCKETS, FFT_MEL_MIN_FREQ, FFT_MEL_MAX_FREQ, FFT_N, (float)rate / factor) < 0)
+    {
+        ESP_LOGE(FFT_TASK_TAG, "Failed to rebuild bucket plans for %u Hz", rate);
+        requested_sample_rate = sample_rate;
+        return;
+    }
+    requested_decimation = factor;
+
+    // Scale the hop so the frame rate stays the same
+    uint32_t hop = (uint32_t)(((uint64_t)stft.hop * new_rate + old_rate / 2) / old_rate);
+    if (fft_stft_set_hop(&stft, hop) < 0)
+    {
+        ESP_LOGW(FFT_TASK_TAG, "Hop size of %u not supported, keeping %u", hop, stft.hop);
+    }
+    sample_rate = rate;
+    agc_hop = 0;
+    beat_hop = 0;
+    ESP_LOGI(FFT_TASK_TAG, "Sample rate set to %u Hz, decimation by %d, hop size %u", sample_rate, factor, stft.hop);
+}
+
+static void update_agc(const uint32_t bucket_mags[])
+{
+    if (!agc_enabled)
+    {
+        return;
+    }
+
+    // The AGC steps are per frame, rescale them when the frame rate changes
+    uint32_t hop = stft.hop;
+    if (hop != agc_hop)
+    {
+        agc_hop = hop;
+        fft_agc_set_rate(&agc, (float)sample_rate / requested_decimation / hop, FFT_BUCKETS);
+    }
+    fft_agc_update(&agc, bucket_mags, FFT_BUCKETS);
+}
+
+static void update_beat(const uint32_t bucket_mags[])
+{
+    // Periods are counted in frames, like the AGC steps
+    uint32_t hop = stft.hop;
+    if (hop != beat_hop)
+    {
+        beat_hop = hop;
+        fft_beat_set_rate(&beat, (float)sample_rate / requested_decimation / hop);
+    }
+    bool onset = fft_beat_update(&beat, bucket_mags, FFT_BUCKETS);
+    beat_bpm = fft_beat_bpm(&beat);
+    // Several beats a second would crowd the state queues, only push them
+    // when something listens
+    if (onset && event_callback_registered(BEAT_DETECTED))
+    {
+        push_event(BEAT_DETECTED, false);
+    }
+}
+
+static int get_decimation_factor(uint32_t rate)
+{
+    // Largest factor whose decimated Nyquist still covers the top bucket
+    uint32_t top = fft_bucket_ranges[FFT_BUCKETS - 1];
+    int factor = FFT_DECIMATOR_MAX_FACTOR;
+    while (factor > 1 && rate / factor < 2 * top)
     {
-        int32_t delta_fft = fft_end_time - fft_start_time;
-        int32_t delta_total = esp_log_timestamp() - fft_start_time;
-        ESP_LOGI(FFT_TASK_TAG, "Delta FFT: %d, Delta Total: %d", delta_fft, delta_total);
+        factor /= 2;
     }
+    return factor;
 }
 
 static void idle_timer_func(TimerHandle_t xTimer)
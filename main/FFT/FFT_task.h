@@ -1,16 +1,31 @@
 #pragma once
 #include <stdint.h>
+#include <stdbool.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
-typedef enum {FFT_LINEAR, FFT_LOG, FFT_LOG_MIRROR, NUM_FFT_DISPLAYS} fft_display_type_t;
+typedef enum {FFT_LINEAR, FFT_LOG, FFT_LOG_MIRROR, FFT_MEL, FFT_SCOPE, FFT_VU, FFT_SPECTROGRAM, FFT_STEREO, FFT_STEREO_SPLIT, NUM_FFT_DISPLAYS} fft_display_type_t;
 
 int init_fft_task();
 void read_data_stream(const uint8_t *data, uint32_t length);
 TaskHandle_t fft_task_handle();
 
+uint32_t get_fft_sample_rate();
+void set_fft_sample_rate(uint32_t rate);
+uint32_t get_fft_hop_size();
+int set_fft_hop_size(uint32_t hop);
+void get_fft_frame_stats(uint32_t *dropped, uint32_t *late);
+void fft_subscribe();
+void fft_unsubscribe();
+bool get_fft_audio_active();
+uint32_t get_fft_beat_bpm();
+
 fft_display_type_t get_fft_display_type();
 void set_fft_display_type(fft_display_type_t fft);
 const char *get_fft_display_type_name(fft_display_type_t fft);
 uint32_t get_fft_log_min();
 void set_fft_log_min(uint32_t log_min);
+bool get_fft_agc_enabled();
+void set_fft_agc_enabled(bool enabled);
+void set_fft_smoothing(uint32_t attack_ms, uint32_t release_ms);
+void set_fft_peak_hold(uint32_t hold_ms, uint32_t fall_rows_per_s);
@@ -1,572 +1,91 @@
 #include "Font.h"
+#include "Font_tables.h"
 #include "FrameBuffer.h"
 #include <string.h>
 
-#define FONT_HEIGHT 5
 #define FONT_WIDTH_DEFAULT  5
-#define NUM_OFFSET 0
-#define CHAR_OFFSET 10
-#define SPECIAL0_OFFSET 36 // ! to /
-#define SPECIAL1_OFFSET 51 // : to >
-#define SPECIAL2_OFFSET 56 // [ to _
-static uint8_t font_data[] = {
-    // 0
-    0x1E,
-    0x12,
-    0x12,
-    0x12,
-    0x1E,
 
-    // 1
-    0x08,
-    0x0C,
-    0x08,
-    0x08,
-    0x1C,
+// Columns drawn into by the blitter, with room for a glyph hanging off
+// either side of the screen so glyphs don't need to be clipped one by one.
+// Screen column x is strip[FONT_MAX_WIDTH + x].
+#define STRIP_COLS (FONT_MAX_WIDTH + FRAME_BUF_COLS + FONT_MAX_WIDTH)
+typedef uint8_t glyph_strip_t[STRIP_COLS];
 
-    // 2
-    0x1E,
-    0x10,
-    0x1E,
-    0x02,
-    0x1E,
-
-    // 3
-    0x1E,
-    0x10,
-    0x1E,
-    0x10,
-    0x1E,
-
-    // 4
-    0x12,
-    0x12,
-    0x1E,
-    0x10,
-    0x10,
-
-    // 5
-    0x1E,
-    0x02,
-    0x1E,
-    0x10,
-    0x1E,
-
-    // 6
-    0x1E,
-    0x02,
-    0x1E,
-    0x12,
-    0x1E,
-
-    // 7
-    0x1E,
-    0x10,
-    0x10,
-    0x10,
-    0x10,
-
-    // 8
-    0x1E,
-    0x12,
-    0x1E,
-    0x12,
-    0x1E,
-
-    // 9
-    0x1E,   
-    0x12,
-    0x1E,
-    0x10,
-    0x1E,
-
-
-    // ------------ Letters-----------
-    // A
-    0x0C,
-    0x12,
-    0x1E,
-    0x12,
-    0x12,
-
-    // B
-    0x0E,
-    0x12,
-    0x0E,
-    0x12,
-    0x0E,
-
-    // C
-    0x0C,
-    0x12,
-    0x02,
-    0x12,
-    0x0C,
-
-    // D
-    0x0E,
-    0x12,
-    0x12,
-    0x12,
-    0x0E,
-
-    // E
-    0x1E,
-    0x02,
-    0x1E,
-    0x02,
-    0x1E,
-
-    // F
-    0x1E,
-    0x02,
-    0x1E,
-    0x02,
-    0x02,
-
-    // G
-    0x0C,
-    0x02,
-    0x1A,
-    0x12,
-    0x0C,
-
-    // H
-    0x12,
-    0x12,
-    0x1E,
-    0x12,
-    0x12,
-
-    // I
-    0x3E,
-    0x08,
-    0x08,
-    0x08,
-    0x3E,
-
-    // J
-    0x10,
-    0x10,
-    0x10,
-    0x12,
-    0x0C,
-
-    // K
-    0x12,
-    0x0A,
-    0x06,
-    0x0A,
-    0x12,
-
-    // L
-    0x02,
-    0x02,
-    0x02,
-    0x02,
-    0x1E,
-
-    // M
-    0x22,
-    0x36,
-    0x2A,
-    0x22,
-    0x22,
-
-    // N
-    0x22,
-    0x26,
-    0x2A,
-    0x32,
-    0x22,
-
-    // O
-    0x0C,
-    0x12,
-    0x12,
-    0x12,
-    0x0C,
-
-    // P
-    0x0E,
-    0x12,
-    0x0E,
-    0x02,
-    0x02,
-
-    // Q
-    0x1C,
-    0x22,
-    0x22,
-    0x12,
-    0x2C,
-
-    // R
-    0x0E,
-    0x12,
-    0x0E,
-    0x12,
-    0x12,
-
-    // S
-    0x1C,
-    0x02,
-    0x0C,
-    0x10,
-    0x0E,
-
-    // T
-    0x3E,
-    0x08,
-    0x08,
-    0x08,
-    0x08,
-    
-    // U
-    0x12,
-    0x12,
-    0x12,
-    0x12,
-    0x0C,
-
-    // V
-    0x22,
-    0x22,
-    0x22,
-    0x14,
-    0x08,
-
-    // W
-    0x22,
-    0x22,
-    0x2A,
-    0x36,
-    0x22,
-
-    // X
-    0x12,
-    0x12,
-    0x0C,
-    0x12,
-    0x12,
-
-    // Y
-    0x12,
-    0x12,
-    0x1E,
-    0x10,
-    0x1E,
-
-    // Z
-    0x1E,
-    0x10,
-    0x0C,
-    0x02,
-    0x1E,
-
-    // ------------ Special Chars (! to /) -----------
-    // !
-    0x02,
-    0x02,
-    0x02,
-    0x00,
-    0x02,
-
-    // "
-    0x0A,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-
-    // #
-    0x14,
-    0x3E,
-    0x14,
-    0x3E,
-    0x14,
-
-    // $
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-
-    // %
-    0x00,
-    0x12,
-    0x08,
-    0x04,
-    0x12,
-
-    // &
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-
-    // '
-    0x02,
-    0x02,
-    0x00,
-    0x00,
-    0x00,
-
-    // (
-    0x04,
-    0x02,
-    0x02,
-    0x02,
-    0x04,
-
-    // )
-    0x02,
-    0x04,
-    0x04,
-    0x04,
-    0x02,
-
-    // *
-    0x00,
-    0x0A,
-    0x04,
-    0x0A,
-    0x00,
-
-    // +
-    0x00,
-    0x04,
-    0x0E,
-    0x04,
-    0x00,
-
-    // ,
-    0x00,
-    0x00,
-    0x00,
-    0x04,
-    0x02,
-
-    // -
-    0x00,
-    0x00,
-    0x0E,
-    0x00,
-    0x00,
-
-    // .
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x02,
-
-    // /
-    0x00,
-    0x10,
-    0x08,
-    0x04,
-    0x02,
-
-    // ------------ Special Chars (: to >) -----------
-    // :
-    0x00,
-    0x02,
-    0x00,
-    0x02,
-    0x00,
-
-    // ;
-    0x00,
-    0x02,
-    0x00,
-    0x02,
-    0x02,
-
-    // <
-    0x08,
-    0x04,
-    0x02,
-    0x04,
-    0x08,
-
-    // = 
-    0x00,
-    0x0E,
-    0x00,
-    0x0E,
-    0x00,
-
-    // >
-    0x02,
-    0x04,
-    0x08,
-    0x04,
-    0x02,
-
-    // ------------ Special Chars ([ to _) -----------
-    // [
-    0x06,
-    0x02,
-    0x02,
-    0x02,
-    0x06,
-
-    // /* \ */
-    0x00,
-    0x02,
-    0x04,
-    0x08,
-    0x10,
-
-    // ]
-    0x06,
-    0x04,
-    0x04,
-    0x04,
-    0x06,
-
-    // ^
-    0x04,
-    0x0A,
-    0x00,
-    0x00,
-    0x00,
-
-    // _
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x0E,
-};
-
-static inline int char_to_idx(char c)
+static inline int glyph_idx(char c)
 {
-    if (c >= '0' && c <= '9') {
-        return (int)((c - '0')*FONT_HEIGHT);
-    }
-    if (c >= '!' && c <= '/') {
-        return (int)((c - '!' + SPECIAL0_OFFSET)*FONT_HEIGHT);
-    }
-    if (c >= ':' && c <= '>') {
-        return (int)((c - ':' + SPECIAL1_OFFSET)*FONT_HEIGHT);
-    }
-    if (c >= '[' && c <= '_') {
-        return (int)((c - '[' + SPECIAL2_OFFSET)*FONT_HEIGHT);
-    }
-
-    if (c >= 'a' && c <= 'z') {
-        c -= ('a' - 'A');
-    }
-    if (c >= 'A' && c <= 'Z') {
-        return (int)((c - 'A' + CHAR_OFFSET)*FONT_HEIGHT);
+    int idx = (int)(unsigned char)c - FONT_FIRST_CHAR;
+    if (idx < 0 || idx >= FONT_GLYPH_COUNT || font_glyph_widths[idx] == 0) {
+        return -1;
     }
-    return -1;
+    return idx;
 }
-inline int get_font_width(char c)
+static inline int advance_width(char c)
 {
-    static uint8_t FONT_WIDTH_LARGE = 6;
-    bool valid_char = false;
-    if (c >= '0' && c <= '9') {
-        valid_char = true;
-    }
-    if (c >= '!' && c <= '/') {
-        valid_char = true;
-    }
-    if (c >= ':' && c <= '>') {
-        valid_char = true;
-    }
-    if (c >= '[' && c <= '_') {
-        valid_char = true;
-    }
-
-    if (c >= 'a' && c <= 'z') {
-        c -= ('a' - 'A');
-    }
-    if (c >= 'A' && c <= 'Z') {
-        valid_char = true;
-    }
-    if (!valid_char) {
-        return -1;
-    }
-
-    switch (c) {
-        case '!':
-        case '\'':
-        case '.':
-        case ':':
-        case ';':
-            return 2;
-        case '(':
-        case ')':
-        case ',':
-        case '[':
-        case ']':
-            return 3;
-        case '\"':
-        case '*':
-        case '+':
-        case '-':
-        case '<':
-        case '=':
-        case '>':
-        case '^':
-        case '_':
-            return 4;
-        case 'I':
-        case 'M':
-        case 'N':
-        case 'Q':
-        case 'T':
-        case 'V':
-        case 'W':
-        case '#':
-            return FONT_WIDTH_LARGE;
-        default:
-            return FONT_WIDTH_DEFAULT;
+    int idx = glyph_idx(c);
+    return (idx < 0) ? FONT_WIDTH_DEFAULT : font_glyph_widths[idx];
+}
+static inline void blit_glyph(int idx, int x, int up, int down, glyph_strip_t *strip)
+{
+    // x is in [-FONT_MAX_WIDTH, FRAME_BUF_COLS), so every column lands in the
+    // strip. Glyphs are padded with blank columns to FONT_MAX_WIDTH.
+    const uint8_t *glyph = font_glyph_columns[idx];
+    uint8_t *dst = &(*strip)[FONT_MAX_WIDTH + x];
+    for (int j = 0; j < FONT_MAX_WIDTH; j++) {
+        dst[j] |= (uint8_t)((glyph[j] >> up) << down);
     }
-    return -1;
 }
+static inline bool glyph_rows_visible(int y)
+{
+    return (y > -FONT_HEIGHT) && (y < FRAME_BUF_ROWS);
+}
+
 int draw_char(char c, int x, int y, display_buffer_t *frame_buffer)
 {
-    int font_idx = char_to_idx(c);
-    int font_width = get_font_width(c);
-    if (font_idx < 0 || font_idx >= sizeof(font_data) || font_width < 0) {
+    int idx = glyph_idx(c);
+    if (idx < 0) {
         return -1;
     }
-    if ((x + font_width) < 0 || x >= FRAME_BUF_COLS) {
+    if ((x + font_glyph_widths[idx]) < 0 || x >= FRAME_BUF_COLS) {
         return -1;
     }
     if ((y + FONT_HEIGHT) < 0 || y >= FRAME_BUF_ROWS) {
         return -1;
     }
-
-    for (int i=0; i<FONT_HEIGHT; i++) {
-         for (int j=0; j<font_width; j++) {
-             if (font_data[font_idx + i] & (1 << j)) {
-                //frame_buffer->setPixel(x + j, i + y);
-                buffer_set_pixel(frame_buffer, x + j, i + y);
-             }
-         }
+    if (!glyph_rows_visible(y)) {
+        return 0;
     }
+
+    glyph_strip_t strip = {0};
+    blit_glyph(idx, x, (y < 0) ? -y : 0, (y > 0) ? y : 0, &strip);
+    buffer_or_columns(frame_buffer, &strip[FONT_MAX_WIDTH]);
     return 0;
 }
 void draw_str(const char *s, int x, int y, display_buffer_t *frame_buffer)
 {
-    if (s == NULL) {
+    if (s == NULL || !glyph_rows_visible(y)) {
         return;
     }
-    int char_x = x;
-    for (int i=0; i<strlen(s); i++) {
-        int width = get_font_width(s[i]);
-        if (width < 0) {
-            width = FONT_WIDTH_DEFAULT;
+
+    // Clip once for the whole string: rows are a shift, columns past the
+    // right edge end the loop and ones before the left edge are skipped
+    int up = (y < 0) ? -y : 0;
+    int down = (y > 0) ? y : 0;
+    glyph_strip_t strip = {0};
+    bool drawn = false;
+    for (; *s != '\0' && x < FRAME_BUF_COLS; s++) {
+        int idx = glyph_idx(*s);
+        if (idx < 0) {
+            x += FONT_WIDTH_DEFAULT;
+            continue;
+        }
+        if (x > -FONT_MAX_WIDTH) {
+            blit_glyph(idx, x, up, down, &strip);
+            drawn = true;
         }
-        draw_char(s[i], char_x, y, frame_buffer);
-        char_x += width;
+        x += font_glyph_widths[idx];
+    }
+    if (drawn) {
+        buffer_or_columns(frame_buffer, &strip[FONT_MAX_WIDTH]);
     }
 }
 void draw_int(int val, int x, int y, display_buffer_t *frame_buffer)
@@ -575,14 +94,33 @@ void draw_int(int val, int x, int y, display_buffer_t *frame_buffer)
         draw_char((char)('0'), x, y, frame_buffer);
         return;
     }
+    if (!glyph_rows_visible(y)) {
+        return;
+    }
+
+    // Least significant digit at x, the rest to its left
+    int up = (y < 0) ? -y : 0;
+    int down = (y > 0) ? y : 0;
+    glyph_strip_t strip = {0};
     int x_loc = x;
-    while (val != 0) {
+    while (val != 0 && x_loc > -FONT_MAX_WIDTH) {
         int i = val % 10;
         val /= 10;
-        char c = (char)(i+'0');
-        draw_char(c, x_loc, y, frame_buffer);
-        x_loc -= get_font_width(c);
+        int idx = glyph_idx((char)(i+'0'));
+        if (idx < 0) {
+            break;
+        }
+        if (x_loc < FRAME_BUF_COLS) {
+            blit_glyph(idx, x_loc, up, down, &strip);
+        }
+        x_loc -= font_glyph_widths[idx];
     }
+    buffer_or_columns(frame_buffer, &strip[FONT_MAX_WIDTH]);
+}
+int get_font_width(char c)
+{
+    int idx = glyph_idx(c);
+    return (idx < 0) ? -1 : font_glyph_widths[idx];
 }
 int get_str_width(const char *str)
 {
@@ -590,12 +128,8 @@ int get_str_width(const char *str)
         return 0;
     }
     int len = 0;
-    for (int i=0; i<strlen(str); i++) {
-        int width = get_font_width(str[i]);
-        if (width < 0) {
-            width = FONT_WIDTH_DEFAULT;
-        }
-        len += width;
+    for (; *str != '\0'; str++) {
+        len += advance_width(*str);
     }
     return len;
-}
\ No newline at end of file
+}
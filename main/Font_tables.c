@@ -0,0 +1,188 @@
+// Generated by Scripts/gen_font_tables.py, do not edit
+#include "Font_tables.h"
+
+const uint8_t font_glyph_widths[FONT_GLYPH_COUNT] = {
+    2, // '!'
+    4, // '"'
+    6, // '#'
+    5, // '$'
+    5, // '%'
+    5, // '&'
+    2, // '\''
+    3, // '('
+    3, // ')'
+    4, // '*'
+    4, // '+'
+    3, // ','
+    4, // '-'
+    2, // '.'
+    5, // '/'
+    5, // '0'
+    5, // '1'
+    5, // '2'
+    5, // '3'
+    5, // '4'
+    5, // '5'
+    5, // '6'
+    5, // '7'
+    5, // '8'
+    5, // '9'
+    2, // ':'
+    2, // ';'
+    4, // '<'
+    4, // '='
+    4, // '>'
+    0, // '?'
+    0, // '@'
+    5, // 'A'
+    5, // 'B'
+    5, // 'C'
+    5, // 'D'
+    5, // 'E'
+    5, // 'F'
+    5, // 'G'
+    5, // 'H'
+    6, // 'I'
+    5, // 'J'
+    5, // 'K'
+    5, // 'L'
+    6, // 'M'
+    6, // 'N'
+    5, // 'O'
+    5, // 'P'
+    6, // 'Q'
+    5, // 'R'
+    5, // 'S'
+    6, // 'T'
+    5, // 'U'
+    6, // 'V'
+    6, // 'W'
+    5, // 'X'
+    5, // 'Y'
+    5, // 'Z'
+    3, // '['
+    5, // '\\'
+    3, // ']'
+    4, // '^'
+    4, // '_'
+    0, // '`'
+    5, // 'a'
+    5, // 'b'
+    5, // 'c'
+    5, // 'd'
+    5, // 'e'
+    5, // 'f'
+    5, // 'g'
+    5, // 'h'
+    6, // 'i'
+    5, // 'j'
+    5, // 'k'
+    5, // 'l'
+    6, // 'm'
+    6, // 'n'
+    5, // 'o'
+    5, // 'p'
+    6, // 'q'
+    5, // 'r'
+    5, // 's'
+    6, // 't'
+    5, // 'u'
+    6, // 'v'
+    6, // 'w'
+    5, // 'x'
+    5, // 'y'
+    5, // 'z'
+};
+
+const uint8_t font_glyph_columns[FONT_GLYPH_COUNT][FONT_MAX_WIDTH] = {
+    {0x00, 0x17, 0x00, 0x00, 0x00, 0x00}, // '!'
+    {0x00, 0x03, 0x00, 0x03, 0x00, 0x00}, // '"'
+    {0x00, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A}, // '#'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // '$'
+    {0x00, 0x12, 0x08, 0x04, 0x12, 0x00}, // '%'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // '&'
+    {0x00, 0x03, 0x00, 0x00, 0x00, 0x00}, // '\''
+    {0x00, 0x0E, 0x11, 0x00, 0x00, 0x00}, // '('
+    {0x00, 0x11, 0x0E, 0x00, 0x00, 0x00}, // ')'
+    {0x00, 0x0A, 0x04, 0x0A, 0x00, 0x00}, // '*'
+    {0x00, 0x04, 0x0E, 0x04, 0x00, 0x00}, // '+'
+    {0x00, 0x10, 0x08, 0x00, 0x00, 0x00}, // ','
+    {0x00, 0x04, 0x04, 0x04, 0x00, 0x00}, // '-'
+    {0x00, 0x10, 0x00, 0x00, 0x00, 0x00}, // '.'
+    {0x00, 0x10, 0x08, 0x04, 0x02, 0x00}, // '/'
+    {0x00, 0x1F, 0x11, 0x11, 0x1F, 0x00}, // '0'
+    {0x00, 0x00, 0x12, 0x1F, 0x10, 0x00}, // '1'
+    {0x00, 0x1D, 0x15, 0x15, 0x17, 0x00}, // '2'
+    {0x00, 0x15, 0x15, 0x15, 0x1F, 0x00}, // '3'
+    {0x00, 0x07, 0x04, 0x04, 0x1F, 0x00}, // '4'
+    {0x00, 0x17, 0x15, 0x15, 0x1D, 0x00}, // '5'
+    {0x00, 0x1F, 0x15, 0x15, 0x1D, 0x00}, // '6'
+    {0x00, 0x01, 0x01, 0x01, 0x1F, 0x00}, // '7'
+    {0x00, 0x1F, 0x15, 0x15, 0x1F, 0x00}, // '8'
+    {0x00, 0x17, 0x15, 0x15, 0x1F, 0x00}, // '9'
+    {0x00, 0x0A, 0x00, 0x00, 0x00, 0x00}, // ':'
+    {0x00, 0x1A, 0x00, 0x00, 0x00, 0x00}, // ';'
+    {0x00, 0x04, 0x0A, 0x11, 0x00, 0x00}, // '<'
+    {0x00, 0x0A, 0x0A, 0x0A, 0x00, 0x00}, // '='
+    {0x00, 0x11, 0x0A, 0x04, 0x00, 0x00}, // '>'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // '?'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // '@'
+    {0x00, 0x1E, 0x05, 0x05, 0x1E, 0x00}, // 'A'
+    {0x00, 0x1F, 0x15, 0x15, 0x0A, 0x00}, // 'B'
+    {0x00, 0x0E, 0x11, 0x11, 0x0A, 0x00}, // 'C'
+    {0x00, 0x1F, 0x11, 0x11, 0x0E, 0x00}, // 'D'
+    {0x00, 0x1F, 0x15, 0x15, 0x15, 0x00}, // 'E'
+    {0x00, 0x1F, 0x05, 0x05, 0x05, 0x00}, // 'F'
+    {0x00, 0x0E, 0x11, 0x15, 0x0C, 0x00}, // 'G'
+    {0x00, 0x1F, 0x04, 0x04, 0x1F, 0x00}, // 'H'
+    {0x00, 0x11, 0x11, 0x1F, 0x11, 0x11}, // 'I'
+    {0x00, 0x08, 0x10, 0x10, 0x0F, 0x00}, // 'J'
+    {0x00, 0x1F, 0x04, 0x0A, 0x11, 0x00}, // 'K'
+    {0x00, 0x1F, 0x10, 0x10, 0x10, 0x00}, // 'L'
+    {0x00, 0x1F, 0x02, 0x04, 0x02, 0x1F}, // 'M'
+    {0x00, 0x1F, 0x02, 0x04, 0x08, 0x1F}, // 'N'
+    {0x00, 0x0E, 0x11, 0x11, 0x0E, 0x00}, // 'O'
+    {0x00, 0x1F, 0x05, 0x05, 0x02, 0x00}, // 'P'
+    {0x00, 0x0E, 0x11, 0x11, 0x09, 0x16}, // 'Q'
+    {0x00, 0x1F, 0x05, 0x05, 0x1A, 0x00}, // 'R'
+    {0x00, 0x12, 0x15, 0x15, 0x09, 0x00}, // 'S'
+    {0x00, 0x01, 0x01, 0x1F, 0x01, 0x01}, // 'T'
+    {0x00, 0x0F, 0x10, 0x10, 0x0F, 0x00}, // 'U'
+    {0x00, 0x07, 0x08, 0x10, 0x08, 0x07}, // 'V'
+    {0x00, 0x1F, 0x08, 0x04, 0x08, 0x1F}, // 'W'
+    {0x00, 0x1B, 0x04, 0x04, 0x1B, 0x00}, // 'X'
+    {0x00, 0x17, 0x14, 0x14, 0x1F, 0x00}, // 'Y'
+    {0x00, 0x19, 0x15, 0x15, 0x13, 0x00}, // 'Z'
+    {0x00, 0x1F, 0x11, 0x00, 0x00, 0x00}, // '['
+    {0x00, 0x02, 0x04, 0x08, 0x10, 0x00}, // '\\'
+    {0x00, 0x11, 0x1F, 0x00, 0x00, 0x00}, // ']'
+    {0x00, 0x02, 0x01, 0x02, 0x00, 0x00}, // '^'
+    {0x00, 0x10, 0x10, 0x10, 0x00, 0x00}, // '_'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // '`'
+    {0x00, 0x1E, 0x05, 0x05, 0x1E, 0x00}, // 'a'
+    {0x00, 0x1F, 0x15, 0x15, 0x0A, 0x00}, // 'b'
+    {0x00, 0x0E, 0x11, 0x11, 0x0A, 0x00}, // 'c'
+    {0x00, 0x1F, 0x11, 0x11, 0x0E, 0x00}, // 'd'
+    {0x00, 0x1F, 0x15, 0x15, 0x15, 0x00}, // 'e'
+    {0x00, 0x1F, 0x05, 0x05, 0x05, 0x00}, // 'f'
+    {0x00, 0x0E, 0x11, 0x15, 0x0C, 0x00}, // 'g'
+    {0x00, 0x1F, 0x04, 0x04, 0x1F, 0x00}, // 'h'
+    {0x00, 0x11, 0x11, 0x1F, 0x11, 0x11}, // 'i'
+    {0x00, 0x08, 0x10, 0x10, 0x0F, 0x00}, // 'j'
+    {0x00, 0x1F, 0x04, 0x0A, 0x11, 0x00}, // 'k'
+    {0x00, 0x1F, 0x10, 0x10, 0x10, 0x00}, // 'l'
+    {0x00, 0x1F, 0x02, 0x04, 0x02, 0x1F}, // 'm'
+    {0x00, 0x1F, 0x02, 0x04, 0x08, 0x1F}, // 'n'
+    {0x00, 0x0E, 0x11, 0x11, 0x0E, 0x00}, // 'o'
+    {0x00, 0x1F, 0x05, 0x05, 0x02, 0x00}, // 'p'
+    {0x00, 0x0E, 0x11, 0x11, 0x09, 0x16}, // 'q'
+    {0x00, 0x1F, 0x05, 0x05, 0x1A, 0x00}, // 'r'
+    {0x00, 0x12, 0x15, 0x15, 0x09, 0x00}, // 's'
+    {0x00, 0x01, 0x01, 0x1F, 0x01, 0x01}, // 't'
+    {0x00, 0x0F, 0x10, 0x10, 0x0F, 0x00}, // 'u'
+    {0x00, 0x07, 0x08, 0x10, 0x08, 0x07}, // 'v'
+    {0x00, 0x1F, 0x08, 0x04, 0x08, 0x1F}, // 'w'
+    {0x00, 0x1B, 0x04, 0x04, 0x1B, 0x00}, // 'x'
+    {0x00, 0x17, 0x14, 0x14, 0x1F, 0x00}, // 'y'
+    {0x00, 0x19, 0x15, 0x15, 0x13, 0x00}, // 'z'
+};
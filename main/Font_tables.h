@@ -0,0 +1,14 @@
+// Generated by Scripts/gen_font_tables.py, do not edit
+#pragma once
+#include <stdint.h>
+
+#define FONT_HEIGHT 5
+#define FONT_MAX_WIDTH 6
+#define FONT_FIRST_CHAR 33 // '!'
+#define FONT_LAST_CHAR 122 // 'z'
+#define FONT_GLYPH_COUNT 90
+
+// Advance width in columns, 0 for characters without a glyph
+extern const uint8_t font_glyph_widths[FONT_GLYPH_COUNT];
+// Bit y of a column is row y of the glyph
+extern const uint8_t font_glyph_columns[FONT_GLYPH_COUNT][FONT_MAX_WIDTH];
@@ -1,6 +1,11 @@
 #include "FrameBuffer.h"
 #include <stdbool.h>
 #include <string.h>
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#else
+#include <time.h>
+#endif
 
 #define BITS_PER_BYTE 8
 #if defined(CONFIG_DEV_BOARD_DISPLAY)
@@ -11,46 +16,140 @@
 #error "Invalid display type"
 #endif
 
+// Parts the frames play, packed into display_buffer_t.roles
+#define ROLE_BITS 2
+#define ROLE_MASK 0x3
+#define ROLES_READ_SHIFT 0
+#define ROLES_WRITE_SHIFT 2
+#define ROLES_COUNT_SHIFT 4
+#define ROLES_FRESH_BIT (1 << 6)
+#define ROLES_DEPTH_SHIFT 7
+#define ROLES_PENDING_SHIFT 10
+
+#if FRAME_QUEUE_MAX_DEPTH > (1 << ROLE_BITS)
+#error "Frame indices don't fit the roles word"
+#endif
+
+typedef struct {
+    int read;
+    int write;
+    int count;                  // Published frames queued, oldest in pending[0]
+    int depth;
+    int pending[FRAME_QUEUE_MAX_DEPTH - 2];
+    bool fresh;                 // Depth 2, read was swapped in since the last start of frame
+} frame_roles_t;
+
 display_buffer_t display_buffer;
 
-void buffer_reset(display_buffer_t *buffer)
+static void clear_frame(frame_buffer_t *frame);
+static void draw_plane(uint8_t plane[FRAME_BUF_ROWS][FRAME_BUF_COL_BYTES], const uint8_t columns[FRAME_BUF_COLS]);
+static uint64_t transpose_group(const uint8_t cols[BITS_PER_BYTE]);
+
+static frame_roles_t decode_roles(uint32_t word)
 {
-    buffer->update = false;
-    buffer->triple_buffering = true;
-    buffer->rbuf = &buffer->buf0;
-    buffer->wbuf = &buffer->buf1;
-    buffer->ibuf = &buffer->buf2;
-    for (int i = 0; i < FRAME_BUF_ROWS; i++)
+    frame_roles_t roles;
+    roles.read = (word >> ROLES_READ_SHIFT) & ROLE_MASK;
+    roles.write = (word >> ROLES_WRITE_SHIFT) & ROLE_MASK;
+    roles.count = (word >> ROLES_COUNT_SHIFT) & ROLE_MASK;
+    roles.depth = (word >> ROLES_DEPTH_SHIFT) & 0x7;
+    roles.fresh = (word & ROLES_FRESH_BIT) != 0;
+    for (int i = 0; i < FRAME_QUEUE_MAX_DEPTH - 2; i++)
     {
-        for (int j = 0; j < FRAME_BUF_COL_BYTES; j++)
-        {
-            buffer->buf0.frame_buffer[i][j] = CLEAR_BYTE;
-            buffer->buf1.frame_buffer[i][j] = CLEAR_BYTE;
-            buffer->buf2.frame_buffer[i][j] = CLEAR_BYTE;
-        }
+        roles.pending[i] = (word >> (ROLES_PENDING_SHIFT + ROLE_BITS * i)) & ROLE_MASK;
     }
+    return roles;
 }
-void buffer_clear(display_buffer_t *buffer)
+static uint32_t encode_roles(const frame_roles_t *roles)
 {
-    for (int i = 0; i < FRAME_BUF_ROWS; i++)
+    uint32_t word = (roles->read << ROLES_READ_SHIFT) | (roles->write << ROLES_WRITE_SHIFT) |
+                    (roles->count << ROLES_COUNT_SHIFT) | (roles->depth << ROLES_DEPTH_SHIFT) |
+                    (roles->fresh ? ROLES_FRESH_BIT : 0);
+    for (int i = 0; i < roles->count; i++)
     {
-        for (int j = 0; j < FRAME_BUF_COL_BYTES; j++)
+        word |= roles->pending[i] << (ROLES_PENDING_SHIFT + ROLE_BITS * i);
+    }
+    return word;
+}
+static void pop_pending(frame_roles_t *roles)
+{
+    for (int i = 1; i < roles->count; i++)
+    {
+        roles->pending[i - 1] = roles->pending[i];
+    }
+    roles->count--;
+}
+static int free_frame(const frame_roles_t *roles)
+{
+    // Any frame not shown, drawn or queued. There always is one below a
+    // full queue since every frame buffer exists at any depth.
+    for (int i = 0; i < FRAME_QUEUE_MAX_DEPTH; i++)
+    {
+        bool used = (i == roles->read || i == roles->write);
+        for (int j = 0; j < roles->count; j++)
         {
-            buffer->wbuf->frame_buffer[i][j] = CLEAR_BYTE;
+            used |= (i == roles->pending[j]);
         }
+        if (!used)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+static const frame_buffer_t *newest_frame(display_buffer_t *buffer)
+{
+    // Producer side, only the producer recycles a published frame
+    frame_roles_t roles = decode_roles(atomic_load_explicit(&buffer->roles, memory_order_acquire));
+    return &buffer->frames[(roles.count > 0) ? roles.pending[roles.count - 1] : roles.read];
+}
+static int64_t buffer_now_us(void)
+{
+#ifdef ESP_PLATFORM
+    return esp_timer_get_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+void buffer_reset(display_buffer_t *buffer)
+{
+    frame_roles_t roles = {.read = 0, .write = 1, .count = 0, .depth = FRAME_QUEUE_DEFAULT_DEPTH, .fresh = false};
+    for (int i = 0; i < FRAME_QUEUE_MAX_DEPTH; i++)
+    {
+        clear_frame(&buffer->frames[i]);
+        buffer->publish_us[i] = 0;
+        buffer->frame_sequence[i] = 0;
     }
+    buffer->sequence = 0;
+    buffer->read_sequence = 0;
+    buffer->update_hook = NULL;
+    buffer->rbuf = &buffer->frames[roles.read];
+    buffer->wbuf = &buffer->frames[roles.write];
+    memset(&buffer->stats, 0, sizeof(frame_queue_stats_t));
+    atomic_store_explicit(&buffer->roles, encode_roles(&roles), memory_order_release);
+}
+void buffer_clear(display_buffer_t *buffer)
+{
+    // Back to depth 1, unused planes are cleared too so equal frames compare equal
+    clear_frame(buffer->wbuf);
 }
 void buffer_copy(display_buffer_t *buffer)
 {
-    memcpy(buffer->wbuf, buffer->rbuf, sizeof(frame_buffer_t));
+    memcpy(buffer->wbuf, newest_frame(buffer), sizeof(frame_buffer_t));
 }
 void buffer_invert(display_buffer_t *buffer)
 {
-    for (int i = 0; i < FRAME_BUF_ROWS; i++)
+    for (int p = 0; p < buffer->wbuf->depth; p++)
     {
-        for (int j = 0; j < FRAME_BUF_COL_BYTES; j++)
+        for (int i = 0; i < FRAME_BUF_ROWS; i++)
         {
-            buffer->wbuf->frame_buffer[i][j] = ~buffer->wbuf->frame_buffer[i][j];
+            uint8_t *row = frame_plane_row(buffer->wbuf, p, i);
+            for (int j = 0; j < FRAME_BUF_COL_BYTES; j++)
+            {
+                row[j] = ~row[j];
+            }
         }
     }
 }
@@ -65,15 +164,18 @@ int buffer_set_pixel(display_buffer_t *buffer, uint8_t x, uint8_t y)
         return -1;
     }
 
+    for (int p = 0; p < buffer->wbuf->depth; p++)
+    {
 #if defined(CONFIG_DEV_BOARD_DISPLAY)
-    int idx = 4 - x / 8;
-    int bit_idx = x % 8;
-    buffer->wbuf->frame_buffer[y][idx] &= ~(1 << bit_idx);
+        int idx = 4 - x / 8;
+        int bit_idx = x % 8;
+        frame_plane_row(buffer->wbuf, p, y)[idx] &= ~(1 << bit_idx);
 #elif defined(CONFIG_FORM_FACTOR_DISPLAY)
-    int idx = x / 8;
-    int bit_idx = x % 8;
-    buffer->wbuf->frame_buffer[y][idx] |= (0x80 >> bit_idx);
+        int idx = x / 8;
+        int bit_idx = x % 8;
+        frame_plane_row(buffer->wbuf, p, y)[idx] |= (0x80 >> bit_idx);
 #endif 
+    }
     return 0;
 }
 int buffer_clear_pixel(display_buffer_t *buffer, uint8_t x, uint8_t y)
@@ -87,15 +189,18 @@ int buffer_clear_pixel(display_buffer_t *buffer, uint8_t x, uint8_t y)
         return -1;
     }
 
+    for (int p = 0; p < buffer->wbuf->depth; p++)
+    {
 #if defined(CONFIG_DEV_BOARD_DISPLAY)
-    int idx = 4 - x / 8;
-    int bit_idx = x % 8;
-    buffer->wbuf->frame_buffer[y][idx] |= (1 << bit_idx);
+        int idx = 4 - x / 8;
+        int bit_idx = x % 8;
+        frame_plane_row(buffer->wbuf, p, y)[idx] |= (1 << bit_idx);
 #elif defined(CONFIG_FORM_FACTOR_DISPLAY)
-    int idx = x / 8;
-    int bit_idx = x % 8;
-    buffer->wbuf->frame_buffer[y][idx] &= ~(0x80 >> bit_idx);
+        int idx = x / 8;
+        int bit_idx = x % 8;
+        frame_plane_row(buffer->wbuf, p, y)[idx] &= ~(0x80 >> bit_idx);
 #endif 
+    }
     return 0;
 }
 int buffer_set_byte(display_buffer_t *buffer, uint8_t x, uint8_t y, uint8_t b)
@@ -110,15 +215,176 @@ int buffer_set_byte(display_buffer_t *buffer, uint8_t x, uint8_t y, uint8_t b)
     }
 
     // 1's in 'b' set pixel, 0's clear pixel
+    for (int p = 0; p < buffer->wbuf->depth; p++)
+    {
 #if defined(CONFIG_DEV_BOARD_DISPLAY)
-    int idx = 4 - x / 8;
-    buffer->wbuf->frame_buffer[y][idx] = (uint8_t)(~b);
+        int idx = 4 - x / 8;
+        frame_plane_row(buffer->wbuf, p, y)[idx] = (uint8_t)(~b);
 #elif defined(CONFIG_FORM_FACTOR_DISPLAY)
-    int idx = x / 8;
-    buffer->wbuf->frame_buffer[y][idx] = b;
+        int idx = x / 8;
+        frame_plane_row(buffer->wbuf, p, y)[idx] = b;
 #endif 
+    }
     return 0;
 }
+void buffer_draw_columns(display_buffer_t *buffer, const uint8_t columns[FRAME_BUF_COLS])
+{
+    // Overwrites the whole frame, so it's back to depth 1
+    draw_plane(buffer->wbuf->frame_buffer, columns);
+    buffer->wbuf->depth = 1;
+}
+/**
+ * @brief Lights every pixel set in columns, same as buffer_set_pixel() on
+ * each of them but a byte at a time. Pixels that aren't set are left as is.
+ * @param columns Bit y of columns[x] is pixel (x, y)
+ */
+void buffer_or_columns(display_buffer_t *buffer, const uint8_t columns[FRAME_BUF_COLS])
+{
+    for (int g = 0; g < FRAME_BUF_COL_BYTES; g++)
+    {
+        const uint8_t *cols = &columns[g * BITS_PER_BYTE];
+        uint64_t any;
+        memcpy(&any, cols, sizeof(any));
+        if (any == 0)
+        {
+            continue;
+        }
+
+        uint64_t m = transpose_group(cols);
+        for (int p = 0; p < buffer->wbuf->depth; p++)
+        {
+            for (int y = 0; y < FRAME_BUF_ROWS; y++)
+            {
+#if defined(CONFIG_DEV_BOARD_DISPLAY)
+                frame_plane_row(buffer->wbuf, p, y)[4 - g] &= (uint8_t)~(m >> (8 * y));
+#elif defined(CONFIG_FORM_FACTOR_DISPLAY)
+                frame_plane_row(buffer->wbuf, p, y)[g] |= (uint8_t)(m >> (8 * y));
+#endif
+            }
+        }
+    }
+}
+/**
+ * @brief Draws a whole frame of grayscale columns, one set of columns per
+ * bit plane as in buffer_draw_columns()
+ * @param planes planes[0] holds the most significant bit of every pixel
+ * @param depth Bits per pixel, 1 to FRAME_BUF_MAX_DEPTH
+ */
+void buffer_draw_column_planes(display_buffer_t *buffer, const uint8_t planes[][FRAME_BUF_COLS], int depth)
+{
+    if (depth < 1 || depth > FRAME_BUF_MAX_DEPTH)
+    {
+        return;
+    }
+    for (int p = 0; p < depth; p++)
+    {
+        draw_plane((p == 0) ? buffer->wbuf->frame_buffer : buffer->wbuf->lower_planes[p - 1], planes[p]);
+    }
+    buffer->wbuf->depth = depth;
+}
+/**
+ * @brief Changes the bits per pixel of the frame being drawn. Fully lit
+ * pixels stay fully on, dropped bits are truncated.
+ * @return 0 on success, -1 if depth is out of range
+ */
+int buffer_set_depth(display_buffer_t *buffer, int depth)
+{
+    if (depth < 1 || depth > FRAME_BUF_MAX_DEPTH)
+    {
+        return -1;
+    }
+    frame_buffer_t *frame = buffer->wbuf;
+    for (int p = 1; p < FRAME_BUF_MAX_DEPTH; p++)
+    {
+        if (p >= depth)
+        {
+            memset(frame->lower_planes[p - 1], CLEAR_BYTE, sizeof(frame->frame_buffer));
+        }
+        else if (p >= frame->depth)
+        {
+            // New bits repeat the lowest one, whole pixels keep every bit equal
+            memcpy(frame->lower_planes[p - 1], frame_plane_row(frame, p - 1, 0), sizeof(frame->frame_buffer));
+        }
+    }
+    frame->depth = depth;
+    return 0;
+}
+/**
+ * @brief Sets one pixel to a level between 0 (off) and 2^depth - 1 (fully on)
+ * at the current depth of the frame being drawn
+ * @return 0 on success, -1 if out of bounds
+ */
+int buffer_set_pixel_level(display_buffer_t *buffer, uint8_t x, uint8_t y, uint8_t level)
+{
+    frame_buffer_t *frame = buffer->wbuf;
+    if (x >= FRAME_BUF_COLS || y >= FRAME_BUF_ROWS || level >= (1 << frame->depth))
+    {
+        return -1;
+    }
+
+    for (int p = 0; p < frame->depth; p++)
+    {
+        bool on = level & (1 << (frame->depth - 1 - p));
+#if defined(CONFIG_DEV_BOARD_DISPLAY)
+        uint8_t mask = (1 << (x % 8));
+        on = !on;
+        uint8_t *b = &frame_plane_row(frame, p, y)[4 - x / 8];
+#elif defined(CONFIG_FORM_FACTOR_DISPLAY)
+        uint8_t mask = (0x80 >> (x % 8));
+        uint8_t *b = &frame_plane_row(frame, p, y)[x / 8];
+#endif
+        *b = on ? (*b | mask) : (*b & ~mask);
+    }
+    return 0;
+}
+static void clear_frame(frame_buffer_t *frame)
+{
+    memset(frame->frame_buffer, CLEAR_BYTE, sizeof(frame->frame_buffer));
+    memset(frame->lower_planes, CLEAR_BYTE, sizeof(frame->lower_planes));
+    frame->depth = 1;
+}
+static void draw_plane(uint8_t plane[FRAME_BUF_ROWS][FRAME_BUF_COL_BYTES], const uint8_t columns[FRAME_BUF_COLS])
+{
+    for (int g = 0; g < FRAME_BUF_COL_BYTES; g++)
+    {
+        uint64_t m = transpose_group(&columns[g * BITS_PER_BYTE]);
+        for (int y = 0; y < FRAME_BUF_ROWS; y++)
+        {
+#if defined(CONFIG_DEV_BOARD_DISPLAY)
+            plane[y][4 - g] = (uint8_t)~(m >> (8 * y));
+#elif defined(CONFIG_FORM_FACTOR_DISPLAY)
+            plane[y][g] = (uint8_t)(m >> (8 * y));
+#endif
+        }
+    }
+}
+static uint64_t transpose_group(const uint8_t cols[BITS_PER_BYTE])
+{
+    // Bit y of cols[k] lights pixel (8g + k, y). The group of 8 columns is
+    // an 8x8 bit matrix, transposing it gives the 8 row bytes of the group,
+    // row y in byte y.
+    uint64_t m = 0;
+    for (int k = 0; k < BITS_PER_BYTE; k++)
+    {
+#if defined(CONFIG_DEV_BOARD_DISPLAY)
+        // Column x is bit x % 8
+        m |= (uint64_t)cols[k] << (8 * k);
+#elif defined(CONFIG_FORM_FACTOR_DISPLAY)
+        // Column x is bit 7 - x % 8
+        m |= (uint64_t)cols[k] << (8 * (7 - k));
+#endif
+    }
+
+    // Swap bit (8i + j) with bit (8j + i) in three steps: 1x1, 2x2 and 4x4 blocks
+    uint64_t t;
+    t = (m ^ (m >> 7)) & 0x00AA00AA00AA00AAULL;
+    m ^= t ^ (t << 7);
+    t = (m ^ (m >> 14)) & 0x0000CCCC0000CCCCULL;
+    m ^= t ^ (t << 14);
+    t = (m ^ (m >> 28)) & 0x00000000F0F0F0F0ULL;
+    m ^= t ^ (t << 28);
+    return m;
+}
 bool buffer_check_pixel(display_buffer_t *buffer, uint8_t x, uint8_t y)
 {
     if (x >= FRAME_BUF_COL_BYTES * BITS_PER_BYTE)
@@ -159,34 +425,200 @@ bool buffer_compare_match(display_buffer_t *buffer)
 }
 void buffer_update(display_buffer_t *buffer)
 {
-    if (!buffer->triple_buffering) 
+    // Compare with the newest published frame, republishing it isn't a change
+    bool changed = (memcmp(buffer->wbuf, newest_frame(buffer), sizeof(frame_buffer_t)) != 0);
+
+    uint32_t word = atomic_load_explicit(&buffer->roles, memory_order_acquire);
+    frame_roles_t roles = decode_roles(word);
+    buffer->publish_us[roles.write] = buffer_now_us();
+    buffer->frame_sequence[roles.write] = buffer->sequence + (changed ? 1 : 0);
+    bool dropped;
+    do
+    {
+        roles = decode_roles(word);
+        int published = roles.write;
+        dropped = false;
+        if (roles.depth == 2)
+        {
+            // Straight into the read buffer, the old one is drawn over next
+            roles.write = roles.read;
+            roles.read = published;
+            dropped = roles.fresh;
+            roles.fresh = true;
+            continue;
+        }
+        if (roles.count == roles.depth - 2)
+        {
+            // Full, the oldest queued frame is never shown and is drawn over next
+            roles.write = roles.pending[0];
+            pop_pending(&roles);
+            dropped = true;
+        }
+        else
+        {
+            roles.write = free_frame(&roles);
+        }
+        roles.pending[roles.count++] = published;
+    } while (!atomic_compare_exchange_weak_explicit(&buffer->roles, &word, encode_roles(&roles),
+                                                    memory_order_acq_rel, memory_order_acquire));
+    buffer->wbuf = &buffer->frames[roles.write];
+    buffer->stats.published++;
+    if (dropped)
     {
-        frame_buffer_t *temp = buffer->rbuf;
-        buffer->rbuf = buffer->wbuf;
-        buffer->wbuf = temp;    
+        buffer->stats.dropped++;
     }
-    else {
-        frame_buffer_t *temp = buffer->ibuf;
-        buffer->ibuf = buffer->wbuf;
-        buffer->wbuf = temp;
-        buffer->update = true;
+
+    // Bumped after publishing, a reader that sees the new sequence also sees the frame
+    if (changed)
+    {
+        buffer->sequence++;
+        if (buffer->update_hook != NULL)
+        {
+            buffer->update_hook();
+        }
     }
 }
-inline void buffer_start_of_frame(display_buffer_t *buffer)
+/**
+ * @brief Display side, takes the oldest published frame into the read
+ * buffer. Without one the read buffer is shown again.
+ * @return true if the read buffer moved on to a newly published frame
+ */
+bool buffer_start_of_frame(display_buffer_t *buffer)
 {
-    if (buffer->triple_buffering && buffer->update)
+    uint32_t word = atomic_load_explicit(&buffer->roles, memory_order_acquire);
+    frame_roles_t roles;
+    bool presented;
+    do
+    {
+        roles = decode_roles(word);
+        presented = roles.fresh;
+        roles.fresh = false;
+        if (roles.count > 0)
+        {
+            roles.read = roles.pending[0];
+            pop_pending(&roles);
+            presented = true;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&buffer->roles, &word, encode_roles(&roles),
+                                                    memory_order_acq_rel, memory_order_acquire));
+    buffer->rbuf = &buffer->frames[roles.read];
+    buffer->read_sequence = buffer->frame_sequence[roles.read];
+
+    if (!presented)
+    {
+        buffer->stats.repeated++;
+        return false;
+    }
+    uint32_t latency = (uint32_t)(buffer_now_us() - buffer->publish_us[roles.read]);
+    buffer->stats.presented++;
+    buffer->stats.latency_us_last = latency;
+    buffer->stats.latency_us_total += latency;
+    if (latency > buffer->stats.latency_us_max)
     {
-        buffer->update = false;
-        frame_buffer_t *temp = buffer->ibuf;
-        buffer->ibuf = buffer->rbuf;
-        buffer->rbuf = temp;
+        buffer->stats.latency_us_max = latency;
     }
+    return true;
 }
 void buffer_enable_triple_buffering(display_buffer_t *buffer, bool triple_buffering)
 {
-    buffer->triple_buffering = triple_buffering;
+    buffer_set_queue_depth(buffer, triple_buffering ? 3 : 2);
+}
+/**
+ * @brief Producer side, sets how many frames the buffer cycles through.
+ * Going down to 2 hands the newest queued frame to the display right away.
+ * @param depth 2 to FRAME_QUEUE_MAX_DEPTH
+ * @return 0 on success, -1 if depth is out of range
+ */
+int buffer_set_queue_depth(display_buffer_t *buffer, int depth)
+{
+    if (depth < 2 || depth > FRAME_QUEUE_MAX_DEPTH)
+    {
+        return -1;
+    }
+    uint32_t word = atomic_load_explicit(&buffer->roles, memory_order_acquire);
+    frame_roles_t roles;
+    int dropped;
+    do
+    {
+        roles = decode_roles(word);
+        dropped = 0;
+        if (depth == 2 && roles.count > 0)
+        {
+            roles.read = roles.pending[roles.count - 1];
+            roles.fresh = true;
+            dropped = roles.count - 1;
+            roles.count = 0;
+        }
+        while (roles.count > depth - 2)
+        {
+            pop_pending(&roles);
+            dropped++;
+        }
+        roles.depth = depth;
+    } while (!atomic_compare_exchange_weak_explicit(&buffer->roles, &word, encode_roles(&roles),
+                                                    memory_order_acq_rel, memory_order_acquire));
+    buffer->stats.dropped += dropped;
+    return 0;
+}
+int buffer_get_queue_depth(display_buffer_t *buffer)
+{
+    return decode_roles(atomic_load_explicit(&buffer->roles, memory_order_acquire)).depth;
+}
+/**
+ * @brief Published frames the display hasn't taken yet. A producer that
+ * draws faster than the refresh rate can skip a frame while this is at
+ * depth - 2 instead of dropping one.
+ */
+int buffer_pending_frames(display_buffer_t *buffer)
+{
+    frame_roles_t roles = decode_roles(atomic_load_explicit(&buffer->roles, memory_order_acquire));
+    return roles.count + (roles.fresh ? 1 : 0);
+}
+void buffer_get_stats(display_buffer_t *buffer, frame_queue_stats_t *stats)
+{
+    memcpy(stats, &buffer->stats, sizeof(frame_queue_stats_t));
 }
 frame_buffer_t *buffer_get_read_buffer(display_buffer_t *buffer)
 {
     return buffer->rbuf;
+}
+/**
+ * @brief Sequence number of the newest published frame, changes only when
+ * the content does. Frames may still be queued behind the read buffer, so
+ * compare it with buffer_get_read_sequence() to know if more is coming.
+ */
+uint32_t buffer_get_sequence(display_buffer_t *buffer)
+{
+    return buffer->sequence;
+}
+/**
+ * @brief Sequence number the read buffer was published with, as of the last
+ * buffer_start_of_frame()
+ */
+uint32_t buffer_get_read_sequence(display_buffer_t *buffer)
+{
+    return buffer->read_sequence;
+}
+void buffer_set_update_hook(display_buffer_t *buffer, void (*hook)(void))
+{
+    buffer->update_hook = hook;
+}
+bool buffer_frame_is_clear(const frame_buffer_t *frame)
+{
+    // A dim pixel may only be lit in the lower planes
+    for (int p = 0; p < frame->depth; p++)
+    {
+        for (int i = 0; i < FRAME_BUF_ROWS; i++)
+        {
+            const uint8_t *row = frame_plane_row((frame_buffer_t *)frame, p, i);
+            for (int j = 0; j < FRAME_BUF_COL_BYTES; j++)
+            {
+                if (row[j] != CLEAR_BYTE)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
 }
\ No newline at end of file
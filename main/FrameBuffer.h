@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdatomic.h>
 #include "sdkconfig.h"
 
 #define FRAME_BUF_ROWS      8
@@ -15,21 +16,55 @@
 #endif
 
 #define FRAME_BUF_COLS (FRAME_BUF_COL_BYTES*8)
+// Most bits per pixel, levels 0 to 2^depth - 1
+#define FRAME_BUF_MAX_DEPTH 4
 
+/*
+ * One bit plane per bit of pixel level, frame_buffer is the most significant
+ * one and the whole pixel at depth 1. The 1-bit drawing functions light or
+ * clear a pixel in every plane, so it is fully on or off at any depth.
+ */
 typedef struct {
     uint8_t frame_buffer[FRAME_BUF_ROWS][FRAME_BUF_COL_BYTES];    
+    uint8_t lower_planes[FRAME_BUF_MAX_DEPTH - 1][FRAME_BUF_ROWS][FRAME_BUF_COL_BYTES]; // Next bits down, [0] is the second most significant
+    uint8_t depth;
 } frame_buffer_t;
 
 
+// Frames a display buffer holds: the one being shown, the one being drawn
+// and up to depth - 2 published ones queued for the display
+#define FRAME_QUEUE_MAX_DEPTH 4
+#define FRAME_QUEUE_DEFAULT_DEPTH 3
+
+typedef struct {
+    uint32_t published;         // Frames handed to the display
+    uint32_t presented;         // Refreshes that picked up a new frame
+    uint32_t dropped;           // Published frames replaced before the display got to them
+    uint32_t repeated;          // Refreshes without a new frame, the last one is shown again
+    uint32_t latency_us_last;   // Publish to start of frame, of the last presented frame
+    uint32_t latency_us_max;
+    uint64_t latency_us_total;  // Over every presented frame
+} frame_queue_stats_t;
+
+/*
+ * One producer draws into wbuf and publishes it with buffer_update(), one
+ * display task takes the oldest published frame into rbuf with
+ * buffer_start_of_frame(). Which buffer plays which part is one atomic word,
+ * so either side can run on either core without a lock. A full queue drops
+ * its oldest frame, at depth 3 the display always gets the newest one. Depth
+ * 2 swaps a published frame straight into rbuf and may tear.
+ */
 typedef struct {
-    frame_buffer_t buf0;
-    frame_buffer_t buf1;
-    frame_buffer_t buf2;
-    frame_buffer_t *rbuf;
-    frame_buffer_t *wbuf;
-    frame_buffer_t *ibuf;
-    bool update;
-    bool triple_buffering;
+    frame_buffer_t frames[FRAME_QUEUE_MAX_DEPTH];
+    int64_t publish_us[FRAME_QUEUE_MAX_DEPTH];
+    uint32_t frame_sequence[FRAME_QUEUE_MAX_DEPTH]; // Sequence each frame was published with
+    frame_buffer_t *wbuf;           // Producer side
+    frame_buffer_t *rbuf;           // Display side
+    _Atomic uint32_t roles;
+    volatile uint32_t sequence;     // Counts published frames that differ from the one before
+    uint32_t read_sequence;         // Display side, sequence of rbuf
+    void (*update_hook)(void);      // Called after a changed frame is published
+    frame_queue_stats_t stats;      // Each count is written by one side only
 } display_buffer_t;
 
 void buffer_reset(display_buffer_t *buffer);
@@ -39,11 +74,32 @@ void buffer_invert(display_buffer_t *buffer);
 int buffer_set_pixel(display_buffer_t *buffer, uint8_t x, uint8_t y);
 int buffer_clear_pixel(display_buffer_t *buffer, uint8_t x, uint8_t y);
 int buffer_set_byte(display_buffer_t *buffer, uint8_t x, uint8_t y, uint8_t b);
+void buffer_draw_columns(display_buffer_t *buffer, const uint8_t columns[FRAME_BUF_COLS]);
+void buffer_or_columns(display_buffer_t *buffer, const uint8_t columns[FRAME_BUF_COLS]);
+void buffer_draw_column_planes(display_buffer_t *buffer, const uint8_t planes[][FRAME_BUF_COLS], int depth);
+int buffer_set_depth(display_buffer_t *buffer, int depth);
+int buffer_set_pixel_level(display_buffer_t *buffer, uint8_t x, uint8_t y, uint8_t level);
 bool buffer_check_pixel(display_buffer_t *buffer, uint8_t x, uint8_t y);
 bool buffer_compare_match(display_buffer_t *buffer);
 void buffer_update(display_buffer_t *buffer);
-void buffer_start_of_frame(display_buffer_t *buffer);
+bool buffer_start_of_frame(display_buffer_t *buffer);
 void buffer_enable_triple_buffering(display_buffer_t *buffer, bool triple_buffering);
+int buffer_set_queue_depth(display_buffer_t *buffer, int depth);
+int buffer_get_queue_depth(display_buffer_t *buffer);
+int buffer_pending_frames(display_buffer_t *buffer);
+void buffer_get_stats(display_buffer_t *buffer, frame_queue_stats_t *stats);
 frame_buffer_t *buffer_get_read_buffer(display_buffer_t *buffer);
+uint32_t buffer_get_sequence(display_buffer_t *buffer);
+uint32_t buffer_get_read_sequence(display_buffer_t *buffer);
+void buffer_set_update_hook(display_buffer_t *buffer, void (*hook)(void));
+bool buffer_frame_is_clear(const frame_buffer_t *frame);
+
+/**
+ * @brief Row y of bit plane p of a frame, plane 0 is the most significant
+ */
+static inline uint8_t *frame_plane_row(frame_buffer_t *frame, int p, int y)
+{
+    return (p == 0) ? frame->frame_buffer[y] : frame->lower_planes[p - 1][y];
+}
 
 extern display_buffer_t display_buffer;
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "Framebuffer.h"
 #include "Font.h"
 #include "Time_Helpers.h"
+#include "FFT_task.h"
 
 #define TAG "MENU_STATE"
 
@@ -28,6 +29,38 @@ typedef enum
 } set_time_state_t;
 set_time_state_t time_idx = SET_TIME_IDLE;
 
+typedef enum
+{
+    MENU_PAGE_SELECT,
+    MENU_PAGE_VISUALIZER,
+    MENU_PAGE_TIME,
+} menu_page_t;
+static menu_page_t menu_page = MENU_PAGE_SELECT;
+
+// Pages reachable from MENU_PAGE_SELECT, in display order
+static const menu_page_t MENU_PAGES[] = {MENU_PAGE_VISUALIZER, MENU_PAGE_TIME};
+static const char *MENU_PAGE_LABELS[] = {"VIS", "TIME"};
+#define NUM_MENU_PAGES (sizeof(MENU_PAGES) / sizeof(MENU_PAGES[0]))
+static int page_idx = 0;
+
+// Short enough to fit the display
+static const char *VISUALIZER_LABELS[NUM_FFT_DISPLAYS] = {
+    "LIN",
+    "LOG",
+    "MIRR",
+    "MEL",
+    "SCOPE",
+    "VU",
+    "SPEC",
+    "STER",
+    "SPLIT",
+};
+static fft_display_type_t visualizer_idx = FFT_LOG;
+
+static int update_select_page(state_manager_t *state_manager, bool next, bool back, bool select, bool cancel);
+static int update_visualizer_page(state_manager_t *state_manager, bool next, bool back, bool select, bool cancel);
+static int update_time_page(state_manager_t *state_manager, bool next, bool back, bool select, bool cancel);
+
 int menu_state_init(state_manager_t *state_manager)
 {
     ESP_LOGI(TAG, "menu_state_init");
@@ -48,6 +81,10 @@ int menu_state_on_enter(state_manager_t *state_manager)
     set_min = min;
     time_idx = SET_TIME_HOURS;
 
+    menu_page = MENU_PAGE_SELECT;
+    page_idx = 0;
+    visualizer_idx = get_fft_display_type();
+
     return 0;
 }
 int menu_state_on_exit(state_manager_t *state_manager)
@@ -103,6 +140,82 @@ int menu_state_update(state_manager_t *state_manager)
         back = false;
     }
 
+    switch (menu_page)
+    {
+    case MENU_PAGE_VISUALIZER:
+        return update_visualizer_page(state_manager, next, back, select, cancel);
+    case MENU_PAGE_TIME:
+        return update_time_page(state_manager, next, back, select, cancel);
+    case MENU_PAGE_SELECT:
+    default:
+        return update_select_page(state_manager, next, back, select, cancel);
+    }
+}
+
+static int update_select_page(state_manager_t *state_manager, bool next, bool back, bool select, bool cancel)
+{
+    if (select)
+    {
+        menu_page = MENU_PAGES[page_idx];
+        return 0;
+    }
+    else if (cancel)
+    {
+        sm_change_state(state_manager, IDLE_STATE_);
+        return 0;
+    }
+    else if (next)
+    {
+        page_idx = (page_idx + 1) % NUM_MENU_PAGES;
+    }
+    else if (back)
+    {
+        page_idx = (page_idx + NUM_MENU_PAGES - 1) % NUM_MENU_PAGES;
+    }
+
+    buffer_clear(&display_buffer);
+    draw_str(MENU_PAGE_LABELS[page_idx], 0, 2, &display_buffer);
+    buffer_update(&display_buffer);
+    return 0;
+}
+
+static int update_visualizer_page(state_manager_t *state_manager, bool next, bool back, bool select, bool cancel)
+{
+    if (select)
+    {
+        ESP_LOGI(TAG, "Setting visualizer to %s", get_fft_display_type_name(visualizer_idx));
+        set_fft_display_type(visualizer_idx);
+        sm_change_state(state_manager, IDLE_STATE_);
+        return 0;
+    }
+    else if (cancel)
+    {
+        sm_change_state(state_manager, IDLE_STATE_);
+        return 0;
+    }
+    else if (next)
+    {
+        visualizer_idx = (visualizer_idx + 1) % NUM_FFT_DISPLAYS;
+    }
+    else if (back)
+    {
+        visualizer_idx = (visualizer_idx + NUM_FFT_DISPLAYS - 1) % NUM_FFT_DISPLAYS;
+    }
+
+    // Flash the label like the time digits being edited
+    bool blank = (flash_cnt < flash_max/2);
+    buffer_clear(&display_buffer);
+    if (!blank)
+    {
+        draw_str(VISUALIZER_LABELS[visualizer_idx], 0, 2, &display_buffer);
+    }
+    buffer_update(&display_buffer);
+    flash_cnt = (flash_cnt + 1) % flash_max;
+    return 0;
+}
+
+static int update_time_page(state_manager_t *state_manager, bool next, bool back, bool select, bool cancel)
+{
     if (select)
     {
         // ESP_LOGI(TAG, "Menu Selected: %d", idx);
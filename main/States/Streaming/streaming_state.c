@@ -4,6 +4,7 @@
 #include "Events.h"
 #include "Framebuffer.h"
 #include "Font.h"
+#include "FFT_task.h"
 
 #define TAG "STREAMING_STATE"
 
@@ -18,11 +19,13 @@ int streaming_state_on_enter(state_manager_t *state_manager)
     ESP_LOGI(TAG, "streaming_state_on_enter");
     buffer_clear(&display_buffer);
     buffer_update(&display_buffer);
+    fft_subscribe();
     return 0;
 }
 int streaming_state_on_exit(state_manager_t *state_manager)
 {
     ESP_LOGI(TAG, "streaming_state_on_exit");
+    fft_unsubscribe();
     return 0;
 }
 int streaming_state_update(state_manager_t *state_manager)
@@ -42,6 +45,10 @@ int streaming_state_update(state_manager_t *state_manager)
     em_system_event_t event;
     QueueHandle_t event_queue = ctx->event_queue;
     while (xQueueReceive(event_queue, &event, 0) == pdTRUE) {
+        if (event == BEAT_DETECTED) {
+            // Several a second while music plays, not worth a log line each
+            continue;
+        }
         ESP_LOGI(TAG, "Event Received: %d", (int)event);
         if (event == STREAMING_TIMEOUT) {
             exit_streaming = true;
@@ -17,6 +17,8 @@
 #include "MAX17048.h"
 #include "message_handlers.h"
 #include "Misc/Time_Helpers.h"
+#include "Display_task.h"
+#include "FrameBuffer.h"
 
 #define TAG "TCP_Msg_Handler"
 
@@ -49,6 +51,9 @@ static int battery_get_soc_handler(tcp_message_t *msg, tcp_message_t *resp, bool
 static int battery_get_voltage_handler(tcp_message_t *msg, tcp_message_t *resp, bool *print_message);
 static int rtc_get_time(tcp_message_t *msg, tcp_message_t *resp, bool *print_message);
 static int rtc_set_time(tcp_message_t *msg, tcp_message_t *resp, bool *print_message);
+static int display_set_brightness_handler(tcp_message_t *msg, tcp_message_t *resp, bool *print_message);
+static int display_set_idle_refresh_handler(tcp_message_t *msg, tcp_message_t *resp, bool *print_message);
+static int display_get_info_handler(tcp_message_t *msg, tcp_message_t *resp, bool *print_message);
 
 tcp_shell_handler_t handler_list[NUM_MESSAGE_IDS] = {
     ack_handler, // Misc
@@ -77,6 +82,9 @@ tcp_shell_handler_t handler_list[NUM_MESSAGE_IDS] = {
     battery_get_voltage_handler,
     rtc_get_time,           // RTC
     rtc_set_time,
+    display_set_brightness_handler, // Display
+    display_set_idle_refresh_handler,
+    display_get_info_handler,
 };
 
 static uint8_t mem_scratch_buf[16] = {0xDE, 0xAD, 0xBE, 0xEF,
@@ -478,4 +486,60 @@ static int rtc_set_time(tcp_message_t *msg, tcp_message_t *resp, bool *print_mes
     set_time_components(time_data->hour, time_data->min, time_data->sec);
     resp->header.message_id = ACK;
     return 0;
+}
+static int display_set_brightness_handler(tcp_message_t *msg, tcp_message_t *resp, bool *print_message)
+{
+    ESP_LOGI(TAG, "DISPLAY_SET_BRIGHTNESS MSG_ID");
+    display_set_brightness_message_t *brightness_msg = (display_set_brightness_message_t *)msg->payload;
+    if (set_display_brightness(brightness_msg->brightness) < 0)
+    {
+        ESP_LOGE(TAG, "Invalid brightness: %d", (int)brightness_msg->brightness);
+        resp->header.message_id = NACK;
+        return 0;
+    }
+    resp->header.message_id = ACK;
+    return 0;
+}
+static int display_set_idle_refresh_handler(tcp_message_t *msg, tcp_message_t *resp, bool *print_message)
+{
+    ESP_LOGI(TAG, "DISPLAY_SET_IDLE_REFRESH MSG_ID");
+    display_set_idle_refresh_message_t *refresh_msg = (display_set_idle_refresh_message_t *)msg->payload;
+    if (set_display_idle_refresh_rate(refresh_msg->refresh_hz) < 0)
+    {
+        ESP_LOGE(TAG, "Invalid idle refresh rate: %dHz", (int)refresh_msg->refresh_hz);
+        resp->header.message_id = NACK;
+        return 0;
+    }
+    resp->header.message_id = ACK;
+    return 0;
+}
+static int display_get_info_handler(tcp_message_t *msg, tcp_message_t *resp, bool *print_message)
+{
+    ESP_LOGI(TAG, "DISPLAY_GET_INFO MSG_ID");
+    display_get_info_resp_t *info_resp = (display_get_info_resp_t *)resp->payload;
+    display_scan_stats_t stats;
+    frame_queue_stats_t queue_stats;
+    get_display_scan_stats(&stats);
+    buffer_get_stats(&display_buffer, &queue_stats);
+
+    info_resp->brightness = get_display_brightness();
+    info_resp->refresh_hz = (uint8_t)get_display_refresh_rate();
+    info_resp->idle_refresh_hz = (uint8_t)get_display_idle_refresh_rate();
+    info_resp->frames = stats.frames;
+    info_resp->writes = stats.writes;
+    info_resp->wakeups = stats.wakeups;
+    info_resp->presented = queue_stats.presented;
+    info_resp->dropped = queue_stats.dropped;
+    info_resp->repeated = queue_stats.repeated;
+    info_resp->latency_us = queue_stats.latency_us_last + stats.photon_lead_us;
+    info_resp->latency_us_max = queue_stats.latency_us_max;
+    info_resp->queue_depth = (uint8_t)buffer_get_queue_depth(&display_buffer);
+
+    ESP_LOGI(TAG, "Brightness = %d, Refresh = %dHz, Idle Refresh = %dHz", (int)info_resp->brightness,
+             (int)info_resp->refresh_hz, (int)info_resp->idle_refresh_hz);
+    ESP_LOGI(TAG, "Presented = %u, Dropped = %u, Repeated = %u, Latency = %uus", info_resp->presented,
+             info_resp->dropped, info_resp->repeated, info_resp->latency_us);
+    resp->header.payload_size = sizeof(display_get_info_resp_t);
+    resp->header.message_id = DISPLAY_GET_INFO;
+    return 0;
 }
\ No newline at end of file
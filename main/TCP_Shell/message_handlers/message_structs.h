@@ -101,4 +101,27 @@ typedef struct __attribute__((packed))
     uint8_t min;
     uint8_t sec;
     uint8_t am;
-} rtc_time_data_t;
\ No newline at end of file
+} rtc_time_data_t;
+typedef struct __attribute__((packed))
+{
+    uint8_t brightness;
+} display_set_brightness_message_t;
+typedef struct __attribute__((packed))
+{
+    uint8_t refresh_hz;
+} display_set_idle_refresh_message_t;
+typedef struct __attribute__((packed))
+{
+    uint8_t brightness;
+    uint8_t refresh_hz;
+    uint8_t idle_refresh_hz;
+    uint32_t frames;
+    uint32_t writes;
+    uint32_t wakeups;
+    uint32_t presented;
+    uint32_t dropped;
+    uint32_t repeated;
+    uint32_t latency_us;     // Producer to first row lit, last presented frame
+    uint32_t latency_us_max; // Producer to start of frame, worst since boot
+    uint8_t queue_depth;
+} display_get_info_resp_t;
\ No newline at end of file
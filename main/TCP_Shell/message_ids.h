@@ -28,6 +28,9 @@ typedef enum {
     BATT_GET_VOLTAGE,
     RTC_GET_TIME,
     RTC_SET_TIME,
+    DISPLAY_SET_BRIGHTNESS,
+    DISPLAY_SET_IDLE_REFRESH,
+    DISPLAY_GET_INFO,
     NUM_MESSAGE_IDS,
 } message_id_t;
 
@@ -267,6 +267,7 @@ static void bt_av_hdl_a2d_evt(uint16_t event, void *p_param)
             }
 
             i2s_set_clk(0, sample_rate, 16, ch_count);
+            set_fft_sample_rate(sample_rate);
 
             ESP_LOGI(BT_AV_TAG, "Configure audio player: %x-%x-%x-%x",
                      a2d->audio_cfg.mcc.cie.sbc[0],
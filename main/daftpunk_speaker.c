@@ -438,8 +438,9 @@ void app_main(void)
     // Enable bluetooth and audio playback
     bt_i2s_task_start_up();
 #ifdef CONFIG_AUDIO_ENABLED
-    // Init Bluetooth Audio and register reader callback
-    bt_audio_register_data_cb(read_data_stream);
+    // Init Bluetooth Audio and register reader callback, the visualizer
+    // taps the stream before volume scaling
+    bt_audio_register_raw_data_cb(read_data_stream);
     bt_audio_init();
     set_rgb_state(RGB_PAIRING);
 #endif
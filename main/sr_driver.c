@@ -1,9 +1,13 @@
 #include "sr_driver.h"
 #include "global_defines.h"
 #include "driver/spi_master.h"
+#include "freertos/FreeRTOS.h"
 #include "esp_log.h"
+#include "esp_attr.h"
 #include "sdkconfig.h"
 
+#include <stdint.h>
+
 #define SR_SPI_BUS SPI3_HOST
 #define PIN_NUM_MOSI 23
 #define PIN_NUM_CLK 18
@@ -11,25 +15,32 @@
 
 #define SR_TAG "SR_DRIVER"
 
+static void post_transaction_cb(spi_transaction_t *trans);
+
 static spi_bus_config_t buscfg = {
     .miso_io_num = -1,
     .mosi_io_num = PIN_NUM_MOSI,
     .sclk_io_num = PIN_NUM_CLK,
     .quadwp_io_num = -1,
     .quadhd_io_num = -1,
-    .max_transfer_sz = 32,
+    .max_transfer_sz = SR_MAX_TRANSFER_BYTES,
 };
 
 static spi_device_interface_config_t dev_config = {
     .address_bits = 0,
     .command_bits = 0,
     .dummy_bits = 0,
-    .clock_speed_hz = 16000000,
+    .clock_speed_hz = SR_CLOCK_HZ,
     .spics_io_num = PIN_NUM_CS,
-    .queue_size = 4,
+    .queue_size = SR_QUEUE_DEPTH,
+    .post_cb = post_transaction_cb,
 };
 
 static spi_device_handle_t handle;
+static spi_transaction_t queued_transactions[SR_QUEUE_DEPTH];
+static int queued_head = 0;
+static int queued_tail = 0;
+static volatile sr_done_callback_t done_callback = NULL;
 #if defined(CONFIG_DEV_BOARD_DISPLAY)
 static const uint8_t CLEAR_DATA[SR_CNT] = {
     0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
@@ -54,13 +65,7 @@ void init_shift_registers()
   ret = spi_bus_add_device(SR_SPI_BUS, &dev_config, &handle);
   ESP_ERROR_CHECK(ret);
 
-  spi_transaction_t spi_transaction = {
-      .length = sizeof(CLEAR_DATA) * 8,
-      .tx_buffer = (void *)CLEAR_DATA,
-  };
-
-  ret = spi_device_transmit(handle, &spi_transaction);
-  ESP_ERROR_CHECK(ret);
+  sr_clear();
 }
 
 void sr_write(uint8_t *data, int N)
@@ -76,3 +81,76 @@ void sr_write_byte(uint8_t val)
 {
   sr_write(&val, 1);
 }
+
+// Deselects every row and clears the column data. Like sr_write(), only
+// call it with no queued writes outstanding.
+void sr_clear()
+{
+  sr_write((uint8_t *)CLEAR_DATA, sizeof(CLEAR_DATA));
+}
+
+void sr_set_done_callback(sr_done_callback_t callback)
+{
+  done_callback = callback;
+}
+
+/**
+ * @brief Queues a write without waiting for it. The shift registers latch
+ * at the end of the transfer, so what was latched before stays on the
+ * outputs while the data is clocked in. Every queued write has to be
+ * collected with sr_collect_write().
+ * @param data DMA capable buffer, must stay untouched until collected
+ * @param id Passed to the done callback and returned by sr_collect_write(), 0 or more
+ * @return 0 on success, -1 if SR_QUEUE_DEPTH writes are outstanding or the
+ * write could not be queued
+ */
+int sr_queue_write(const uint8_t *data, int N, int id)
+{
+  if (queued_head - queued_tail >= SR_QUEUE_DEPTH)
+  {
+    return -1;
+  }
+  spi_transaction_t *trans = &queued_transactions[queued_head % SR_QUEUE_DEPTH];
+  *trans = (spi_transaction_t){
+      .length = N * 8,
+      .tx_buffer = data,
+      .user = (void *)(intptr_t)(id + 1), // NULL marks sr_write() transactions
+  };
+  if (spi_device_queue_trans(handle, trans, 0) != ESP_OK)
+  {
+    return -1;
+  }
+  queued_head++;
+  return 0;
+}
+
+/**
+ * @brief Waits for the oldest queued write to finish
+ * @param id Set to the id it was queued with
+ * @return 0 on success, -1 if no write is outstanding
+ */
+int sr_collect_write(int *id)
+{
+  if (queued_head == queued_tail)
+  {
+    return -1;
+  }
+  spi_transaction_t *trans;
+  if (spi_device_get_trans_result(handle, &trans, portMAX_DELAY) != ESP_OK)
+  {
+    return -1;
+  }
+  queued_tail++;
+  *id = (int)(intptr_t)trans->user - 1;
+  return 0;
+}
+
+// Private Functions
+static void IRAM_ATTR post_transaction_cb(spi_transaction_t *trans)
+{
+  sr_done_callback_t callback = done_callback;
+  if (callback != NULL && trans != NULL && trans->user != NULL)
+  {
+    callback((int)(intptr_t)trans->user - 1);
+  }
+}
@@ -1,6 +1,18 @@
 #pragma once
 #include <stdint.h>
 
+#define SR_CLOCK_HZ 1000000
+#define SR_MAX_TRANSFER_BYTES 512
+#define SR_QUEUE_DEPTH 16
+
+// Called from the SPI interrupt when a queued write finishes, must be in IRAM
+typedef void (*sr_done_callback_t)(int id);
+
 void init_shift_registers();
 void sr_write(uint8_t *data, int N);
-void sr_write_byte(uint8_t val);
\ No newline at end of file
+void sr_write_byte(uint8_t val);
+void sr_clear();
+
+void sr_set_done_callback(sr_done_callback_t callback);
+int sr_queue_write(const uint8_t *data, int N, int id);
+int sr_collect_write(int *id);